@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace pldm
+{
+namespace utils
+{
+
+/** @class Crc32
+ *
+ *  Incremental CRC-32 (ISO 3309 / IEEE 802.3), the integrity checksum PLDM
+ *  uses for multipart transfers and tables. Feeding the data in several parts
+ *  gives the same checksum as libpldm's crc32() over all of it, so a checksum
+ *  can be kept up to date as the data is received or built.
+ */
+class Crc32
+{
+  public:
+    /** @brief Add data to the checksum
+     *
+     *  @param[in] data - next bytes of the data
+     */
+    void update(std::span<const uint8_t> data)
+    {
+        for (auto byte : data)
+        {
+            state = table[(state ^ byte) & 0xff] ^ (state >> 8);
+        }
+    }
+
+    /** @brief Get the checksum of the data added so far */
+    uint32_t value() const
+    {
+        return state ^ 0xffffffff;
+    }
+
+    /** @brief Start over with no data */
+    void reset()
+    {
+        state = 0xffffffff;
+    }
+
+  private:
+    static constexpr std::array<uint32_t, 256> table = []() {
+        std::array<uint32_t, 256> entries{};
+        for (uint32_t i = 0; i < entries.size(); i++)
+        {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; bit++)
+            {
+                crc = (crc & 1) ? (crc >> 1) ^ 0xedb88320 : crc >> 1;
+            }
+            entries[i] = crc;
+        }
+        return entries;
+    }();
+
+    uint32_t state = 0xffffffff;
+};
+
+} // namespace utils
+} // namespace pldm
@@ -3,9 +3,15 @@
 #include <common/utils.hpp>
 #include <phosphor-logging/lg2.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <span>
 #include <vector>
 
 PHOSPHOR_LOG2_USING;
@@ -15,11 +21,6 @@ namespace pldm
 namespace flightrecorder
 {
 using ReqOrResponse = bool;
-using FlightRecorderData = std::vector<uint8_t>;
-using FlightRecorderTimeStamp = std::string;
-using FlightRecorderRecord =
-    std::tuple<FlightRecorderTimeStamp, ReqOrResponse, FlightRecorderData>;
-using FlightRecorderCassette = std::vector<FlightRecorderRecord>;
 static constexpr auto flightRecorderDumpPath = "/tmp/pldm_flight_recorder";
 
 /** @class FlightRecorder
@@ -27,26 +28,38 @@ static constexpr auto flightRecorderDumpPath = "/tmp/pldm_flight_recorder";
  *  The class for implementing the PLDM flight recorder logic. This class
  *  handles the insertion of the data into the recorder and also provides
  *  API's to dump the flight recorder into a file.
+ *
+ *  The recorder is a ring of fixed size slots allocated up front. Recording a
+ *  message claims the next slot with a single atomic increment, copies the raw
+ *  bytes and stamps the slot with the monotonic clock, all formatting is left
+ *  to playRecorder. Messages longer than a slot are truncated, the slot keeps
+ *  their original length.
  */
-
 class FlightRecorder
 {
-  private:
-    FlightRecorder() : index(0)
+  public:
+    /** @brief Constructor
+     *
+     *  @param[in] entries - number of messages kept by the recorder, the
+     *                       recorder is disabled if it is 0, reduced so the
+     *                       ring fits in maxTapeSize bytes
+     *  @param[in] msgSize - number of bytes kept of each message
+     */
+    FlightRecorder(size_t entries, size_t msgSize) :
+        maxEntries(
+            std::min(entries, maxTapeSize / std::max<size_t>(msgSize, 1))),
+        maxMsgSize(msgSize), flightRecorderPolicy(maxEntries && maxMsgSize)
     {
-        flightRecorderPolicy = FLIGHT_RECORDER_MAX_ENTRIES ? true : false;
         if (flightRecorderPolicy)
         {
-            tapeRecorder = FlightRecorderCassette(FLIGHT_RECORDER_MAX_ENTRIES);
+            slots.resize(maxEntries);
+            tape.resize(maxEntries * maxMsgSize);
         }
     }
 
-  protected:
-    int index;
-    FlightRecorderCassette tapeRecorder;
-    bool flightRecorderPolicy;
+    /** @brief Largest number of message bytes preallocated */
+    static constexpr size_t maxTapeSize = 16 * 1024 * 1024;
 
-  public:
     FlightRecorder(const FlightRecorder&) = delete;
     FlightRecorder(FlightRecorder&&) = delete;
     FlightRecorder& operator=(const FlightRecorder&) = delete;
@@ -55,7 +68,8 @@ class FlightRecorder
 
     static FlightRecorder& GetInstance()
     {
-        static FlightRecorder flightRecorder;
+        static FlightRecorder flightRecorder(FLIGHT_RECORDER_MAX_ENTRIES,
+                                             FLIGHT_RECORDER_MAX_MESSAGE_SIZE);
         return flightRecorder;
     }
 
@@ -67,59 +81,123 @@ class FlightRecorder
      *
      *  @return void
      */
-    void saveRecord(const FlightRecorderData& buffer, ReqOrResponse isRequest)
+    void saveRecord(std::span<const uint8_t> buffer, ReqOrResponse isRequest)
     {
         // if the flight recorder policy is enabled, then only insert the
         // messages into the flight recorder, if not this function will be just
         // a no-op
         if (flightRecorderPolicy)
         {
-            int currentIndex = index++;
-            tapeRecorder[currentIndex] = std::make_tuple(
-                pldm::utils::getCurrentSystemTime(), isRequest, buffer);
-            index = (currentIndex == FLIGHT_RECORDER_MAX_ENTRIES - 1) ? 0
-                                                                      : index;
+            auto seq = head.fetch_add(1, std::memory_order_relaxed);
+            auto index = seq % maxEntries;
+            auto length = std::min(buffer.size(), maxMsgSize);
+
+            std::copy_n(buffer.begin(), length,
+                        tape.begin() + index * maxMsgSize);
+            slots[index] = Slot{now(), static_cast<uint32_t>(buffer.size()),
+                                static_cast<uint32_t>(length), isRequest};
         }
     }
 
+    /** @brief Get the number of messages kept by the recorder */
+    size_t getMaxEntries() const
+    {
+        return flightRecorderPolicy ? maxEntries : 0;
+    }
+
+    /** @brief Get the number of messages recorded so far */
+    uint64_t getRecordCount() const
+    {
+        return head.load(std::memory_order_relaxed);
+    }
+
     /** @brief play flight recorder
+     *
+     *  @param[in] dumpPath - file to dump the recorded messages into
      *
      *  @return void
      */
-
-    void playRecorder()
+    void playRecorder(const char* dumpPath = flightRecorderDumpPath) const
     {
-        if (flightRecorderPolicy)
+        if (!flightRecorderPolicy)
         {
-            std::ofstream recorderOutputFile(flightRecorderDumpPath);
-            info("Dumping the flight recorder into : {DUMP_PATH}", "DUMP_PATH",
-                 flightRecorderDumpPath);
-            for (const auto& message : tapeRecorder)
-            {
-                recorderOutputFile << std::get<FlightRecorderTimeStamp>(message)
-                                   << " : ";
-                if (std::get<ReqOrResponse>(message))
-                {
-                    recorderOutputFile << "Tx : \n";
-                }
-                else
-                {
-                    recorderOutputFile << "Rx : \n";
-                }
-                for (const auto& word : std::get<FlightRecorderData>(message))
-                {
-                    recorderOutputFile << std::setfill('0') << std::setw(2)
-                                       << std::hex << (unsigned)word << " ";
-                }
-                recorderOutputFile << std::endl;
-            }
-            recorderOutputFile.close();
+            error("Fight recorder policy is disabled");
+            return;
         }
-        else
+
+        std::ofstream recorderOutputFile(dumpPath);
+        info("Dumping the flight recorder into : {DUMP_PATH}", "DUMP_PATH",
+             dumpPath);
+
+        // Convert the monotonic stamps to the wall clock once, at dump time
+        using namespace std::chrono;
+        auto offset = duration_cast<nanoseconds>(
+                          system_clock::now().time_since_epoch())
+                          .count() -
+                      static_cast<int64_t>(now());
+
+        // Oldest message first
+        auto end = head.load(std::memory_order_relaxed);
+        auto begin = end > maxEntries ? end - maxEntries : 0;
+        for (auto seq = begin; seq < end; seq++)
         {
-            error("Fight recorder policy is disabled");
+            const auto& slot = slots[seq % maxEntries];
+            auto wallNs = static_cast<int64_t>(slot.timestamp) + offset;
+            std::time_t tt = wallNs / 1000000000;
+            recorderOutputFile << std::put_time(std::localtime(&tt),
+                                                "%F %Z %T.")
+                               << std::dec << std::setfill('0') << std::setw(6)
+                               << (wallNs % 1000000000) / 1000 << " : ";
+            if (slot.isRequest)
+            {
+                recorderOutputFile << "Tx : \n";
+            }
+            else
+            {
+                recorderOutputFile << "Rx : \n";
+            }
+            auto data = tape.begin() + (seq % maxEntries) * maxMsgSize;
+            for (uint32_t i = 0; i < slot.recorded; i++)
+            {
+                recorderOutputFile << std::setfill('0') << std::setw(2)
+                                   << std::hex << (unsigned)data[i] << " ";
+            }
+            if (slot.recorded < slot.length)
+            {
+                recorderOutputFile << std::dec << "... (" << slot.length
+                                   << " bytes)";
+            }
+            recorderOutputFile << std::endl;
         }
+        recorderOutputFile.close();
     }
+
+  private:
+    /** @brief Recorded message metadata, the bytes live in the tape */
+    struct Slot
+    {
+        uint64_t timestamp = 0; //!< monotonic time in nanoseconds
+        uint32_t length = 0;    //!< length of the message
+        uint32_t recorded = 0;  //!< number of bytes kept in the tape
+        ReqOrResponse isRequest = false;
+    };
+
+    /** @brief Read the monotonic clock in nanoseconds */
+    static uint64_t now()
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<uint64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+    }
+
+    const size_t maxEntries;
+    const size_t maxMsgSize;
+    const bool flightRecorderPolicy;
+    /** @brief Sequence number of the next message to record */
+    std::atomic<uint64_t> head{0};
+    std::vector<Slot> slots;
+    /** @brief Message bytes, maxMsgSize bytes per slot */
+    std::vector<uint8_t> tape;
 };
 
 } // namespace flightrecorder
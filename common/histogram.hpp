@@ -0,0 +1,85 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+
+namespace pldm
+{
+namespace utils
+{
+
+/** @class Log2Histogram
+ *
+ *  Histogram of durations in power of two buckets of microseconds. Bucket n
+ *  counts the durations below 2^n microseconds that don't fit a lower bucket,
+ *  the last bucket also counts the longer ones. The percentiles it gives are
+ *  upper bounds within a factor of two.
+ */
+class Log2Histogram
+{
+  public:
+    static constexpr size_t buckets = 40;
+
+    /** @brief Record a duration, a negative one counts as zero */
+    void record(std::chrono::steady_clock::duration duration)
+    {
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(
+                      duration)
+                      .count();
+        auto value = static_cast<uint64_t>(us > 0 ? us : 0);
+        counts[std::min<size_t>(std::bit_width(value), buckets - 1)]++;
+        total++;
+    }
+
+    /** @brief Get the number of durations recorded */
+    uint64_t getCount() const
+    {
+        return total;
+    }
+
+    /** @brief Get the number of durations in a bucket */
+    uint64_t getBucketCount(size_t bucket) const
+    {
+        return bucket < buckets ? counts[bucket] : 0;
+    }
+
+    /** @brief Get the exclusive upper bound of a bucket in microseconds */
+    static uint64_t getBucketLimit(size_t bucket)
+    {
+        return uint64_t{1} << bucket;
+    }
+
+    /** @brief Get an upper bound of a percentile of the durations in
+     *         microseconds, 0 if none is recorded
+     *
+     *  @param[in] percent - the percentile, from 0 to 100
+     */
+    uint64_t getPercentile(uint64_t percent) const
+    {
+        if (!total)
+        {
+            return 0;
+        }
+        auto rank = (total * percent + 99) / 100;
+        uint64_t seen = 0;
+        for (size_t bucket = 0; bucket < buckets; bucket++)
+        {
+            seen += counts[bucket];
+            if (seen >= rank)
+            {
+                return bucket ? getBucketLimit(bucket) - 1 : 0;
+            }
+        }
+        return UINT64_MAX;
+    }
+
+  private:
+    std::array<uint64_t, buckets> counts{};
+    uint64_t total = 0;
+};
+
+} // namespace utils
+} // namespace pldm
@@ -0,0 +1,42 @@
+#include "common/crc32.hpp"
+
+#include <libpldm/utils.h>
+
+#include <algorithm>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::utils;
+
+TEST(Crc32, checkValue)
+{
+    constexpr std::string_view check = "123456789";
+    Crc32 crc;
+    EXPECT_EQ(crc.value(), 0);
+    crc.update({reinterpret_cast<const uint8_t*>(check.data()), check.size()});
+    EXPECT_EQ(crc.value(), 0xcbf43926);
+
+    crc.reset();
+    EXPECT_EQ(crc.value(), 0);
+}
+
+TEST(Crc32, incrementalMatchesOneShot)
+{
+    std::vector<uint8_t> data(1000);
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+
+    Crc32 crc;
+    std::span<const uint8_t> rest(data);
+    for (size_t part = 1; !rest.empty(); part *= 2)
+    {
+        auto count = std::min(part, rest.size());
+        crc.update(rest.first(count));
+        rest = rest.subspan(count);
+    }
+    EXPECT_EQ(crc.value(), crc32(data.data(), data.size()));
+}
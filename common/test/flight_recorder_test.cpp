@@ -0,0 +1,120 @@
+#include "common/flight_recorder.hpp"
+
+#include <unistd.h>
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::flightrecorder;
+
+namespace
+{
+
+std::string dump(const FlightRecorder& recorder)
+{
+    char path[] = "/tmp/pldm_flight_recorder_test.XXXXXX";
+    int fd = mkstemp(path);
+    EXPECT_NE(fd, -1);
+    close(fd);
+    recorder.playRecorder(path);
+    std::ifstream in(path);
+    std::string out((std::istreambuf_iterator<char>(in)),
+                    std::istreambuf_iterator<char>());
+    std::remove(path);
+    return out;
+}
+
+} // namespace
+
+TEST(FlightRecorder, disabled)
+{
+    FlightRecorder recorder(0, 256);
+    std::array<uint8_t, 4> msg{0x80, 0x02, 0x11, 0x00};
+    recorder.saveRecord(msg, true);
+    EXPECT_EQ(recorder.getRecordCount(), 0);
+}
+
+TEST(FlightRecorder, ringFitsTapeSize)
+{
+    // 65536 messages of 65536 bytes would need 4 GiB
+    FlightRecorder recorder(65536, 65536);
+    EXPECT_EQ(recorder.getMaxEntries(), FlightRecorder::maxTapeSize / 65536);
+
+    std::array<uint8_t, 2> msg{0x01, 0x02};
+    for (size_t i = 0; i <= recorder.getMaxEntries(); i++)
+    {
+        recorder.saveRecord(msg, true);
+    }
+    auto out = dump(recorder);
+    size_t played = 0;
+    for (auto pos = out.find("Tx : "); pos != std::string::npos;
+         pos = out.find("Tx : ", pos + 1))
+    {
+        played++;
+    }
+    EXPECT_EQ(played, recorder.getMaxEntries());
+
+    // Not even one message fits, the recorder is disabled
+    FlightRecorder tooLarge(4, FlightRecorder::maxTapeSize + 1);
+    EXPECT_EQ(tooLarge.getMaxEntries(), 0);
+    tooLarge.saveRecord(msg, true);
+    EXPECT_EQ(tooLarge.getRecordCount(), 0);
+}
+
+TEST(FlightRecorder, playOldestFirst)
+{
+    FlightRecorder recorder(2, 256);
+    std::array<uint8_t, 2> first{0x01, 0x02};
+    std::array<uint8_t, 2> second{0x03, 0x04};
+    std::array<uint8_t, 2> third{0x05, 0x06};
+    recorder.saveRecord(first, true);
+    recorder.saveRecord(second, false);
+    recorder.saveRecord(third, true);
+    EXPECT_EQ(recorder.getRecordCount(), 3);
+
+    auto out = dump(recorder);
+    EXPECT_EQ(out.find("01 02"), std::string::npos);
+    auto rx = out.find("Rx : \n03 04 ");
+    auto tx = out.find("Tx : \n05 06 ");
+    ASSERT_NE(rx, std::string::npos);
+    ASSERT_NE(tx, std::string::npos);
+    EXPECT_LT(rx, tx);
+}
+
+TEST(FlightRecorder, truncateLongMessage)
+{
+    FlightRecorder recorder(1, 8);
+    std::array<uint8_t, 12> msg{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    recorder.saveRecord(msg, false);
+
+    auto out = dump(recorder);
+    EXPECT_NE(out.find("00 01 02 03 04 05 06 07 ... (12 bytes)"),
+              std::string::npos);
+    EXPECT_EQ(out.find(" 08 "), std::string::npos);
+}
+
+TEST(FlightRecorder, saveRecordOverhead)
+{
+    constexpr size_t iterations = 1000000;
+    FlightRecorder recorder(1024, 256);
+    std::array<uint8_t, 64> msg{};
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++)
+    {
+        msg[0] = static_cast<uint8_t>(i);
+        recorder.saveRecord(msg, i & 1);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    EXPECT_EQ(recorder.getRecordCount(), iterations);
+    auto perMsg = elapsed.count() / iterations;
+    RecordProperty("ns_per_message", std::to_string(perMsg));
+}
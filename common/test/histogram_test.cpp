@@ -0,0 +1,45 @@
+#include "common/histogram.hpp"
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::utils;
+using namespace std::chrono_literals;
+
+TEST(Log2Histogram, empty)
+{
+    Log2Histogram histogram;
+    EXPECT_EQ(histogram.getCount(), 0);
+    EXPECT_EQ(histogram.getPercentile(50), 0);
+    EXPECT_EQ(histogram.getPercentile(99), 0);
+}
+
+TEST(Log2Histogram, percentiles)
+{
+    Log2Histogram histogram;
+    for (int i = 0; i < 99; i++)
+    {
+        histogram.record(100us);
+    }
+    histogram.record(5ms);
+
+    EXPECT_EQ(histogram.getCount(), 100);
+    EXPECT_EQ(histogram.getBucketCount(7), 99);
+    EXPECT_EQ(histogram.getBucketLimit(7), 128);
+    EXPECT_EQ(histogram.getBucketCount(13), 1);
+    EXPECT_EQ(histogram.getPercentile(50), 127);
+    EXPECT_EQ(histogram.getPercentile(99), 127);
+    EXPECT_EQ(histogram.getPercentile(100), 8191);
+}
+
+TEST(Log2Histogram, outOfRangeDurations)
+{
+    Log2Histogram histogram;
+    histogram.record(-1ms);
+    EXPECT_EQ(histogram.getBucketCount(0), 1);
+
+    histogram.record(std::chrono::hours(24 * 365 * 100));
+    EXPECT_EQ(histogram.getBucketCount(Log2Histogram::buckets - 1), 1);
+    EXPECT_EQ(histogram.getBucketCount(Log2Histogram::buckets), 0);
+}
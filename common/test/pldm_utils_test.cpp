@@ -1,6 +1,14 @@
 #include "common/utils.hpp"
 
 #include <libpldm/platform.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -1012,3 +1020,326 @@ TEST(Split, allTestCases)
     auto results5 = split(s5, "\\");
     EXPECT_EQ(results5[0], "aa");
 }
+
+TEST(DBusServiceCache, hitAndMiss)
+{
+    DBusServiceCache cache;
+    EXPECT_EQ(cache.get("/a", "x.y.Z"), std::nullopt);
+    cache.set("/a", "x.y.Z", "x.y.Service");
+    EXPECT_EQ(cache.get("/a", "x.y.Z"), "x.y.Service");
+    EXPECT_EQ(cache.get("/a", "x.y.Other"), std::nullopt);
+    EXPECT_EQ(cache.getHits(), 1);
+    EXPECT_EQ(cache.getMisses(), 2);
+}
+
+TEST(DBusServiceCache, eraseService)
+{
+    DBusServiceCache cache;
+    cache.set("/a", "x.y.Z", "x.y.Service");
+    cache.set("/b", "x.y.Z", "x.y.Service");
+    cache.set("/c", "x.y.Z", "x.y.Other");
+    cache.eraseService("x.y.Service");
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_EQ(cache.get("/c", "x.y.Z"), "x.y.Other");
+}
+
+TEST(DBusServiceCache, eraseInterfaces)
+{
+    DBusServiceCache cache;
+    cache.set("/a", "x.y.Z", "x.y.Service");
+    cache.set("/a", "x.y.W", "x.y.Service");
+    cache.set("/a", "", "x.y.Service");
+    cache.set("/b", "x.y.Z", "x.y.Service");
+
+    cache.eraseInterfaces("/a", {"x.y.Z"});
+    EXPECT_EQ(cache.get("/a", "x.y.Z"), std::nullopt);
+    EXPECT_EQ(cache.get("/a", ""), std::nullopt);
+    EXPECT_EQ(cache.get("/a", "x.y.W"), "x.y.Service");
+
+    cache.eraseInterfaces("/a", {});
+    EXPECT_EQ(cache.get("/a", "x.y.W"), std::nullopt);
+    EXPECT_EQ(cache.get("/b", "x.y.Z"), "x.y.Service");
+}
+
+TEST(DBusServiceCache, containsPath)
+{
+    DBusServiceCache cache;
+    cache.set("/a/b", "x.y.Z", "x.y.Service");
+    EXPECT_TRUE(cache.containsPath("/a/b"));
+    EXPECT_FALSE(cache.containsPath("/a"));
+    EXPECT_FALSE(cache.containsPath("/a/b/c"));
+}
+
+class DrainReadyMessages : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ASSERT_EQ(socketpair(AF_UNIX, SOCK_SEQPACKET, 0, fds.data()), 0);
+    }
+
+    void TearDown() override
+    {
+        close(fds[0]);
+        close(fds[1]);
+    }
+
+    void sendMsgs(size_t count)
+    {
+        std::array<uint8_t, 4> msg{0x80, 0x02, 0x11, 0x00};
+        for (size_t i = 0; i < count; i++)
+        {
+            ASSERT_EQ(send(fds[1], msg.data(), msg.size(), 0),
+                      static_cast<ssize_t>(msg.size()));
+        }
+    }
+
+    bool recvMsg()
+    {
+        std::array<uint8_t, 64> buf{};
+        return recv(fds[0], buf.data(), buf.size(), MSG_DONTWAIT) > 0;
+    }
+
+    std::array<int, 2> fds{-1, -1};
+};
+
+TEST_F(DrainReadyMessages, drainsAllReadyMessages)
+{
+    sendMsgs(5);
+    EXPECT_EQ(drainReadyMessages(fds[0], 32, [this]() { return recvMsg(); }),
+              5);
+    EXPECT_FALSE(recvMsg());
+}
+
+TEST_F(DrainReadyMessages, stopsAtBudget)
+{
+    sendMsgs(10);
+    EXPECT_EQ(drainReadyMessages(fds[0], 4, [this]() { return recvMsg(); }),
+              4);
+    EXPECT_EQ(drainReadyMessages(fds[0], 4, [this]() { return recvMsg(); }),
+              4);
+    EXPECT_EQ(drainReadyMessages(fds[0], 4, [this]() { return recvMsg(); }),
+              2);
+}
+
+TEST_F(DrainReadyMessages, stopsWhenHandlerFails)
+{
+    sendMsgs(3);
+    EXPECT_EQ(drainReadyMessages(fds[0], 32, []() { return false; }), 1);
+}
+
+TEST_F(DrainReadyMessages, burstThroughput)
+{
+    constexpr size_t burst = 64;
+    constexpr size_t bursts = 200;
+    size_t wakeups = 0;
+    size_t handled = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < bursts; i++)
+    {
+        sendMsgs(burst);
+        size_t pending = burst;
+        while (pending)
+        {
+            auto count = drainReadyMessages(fds[0], 32,
+                                            [this]() { return recvMsg(); });
+            pending -= count;
+            handled += count;
+            wakeups++;
+        }
+    }
+    auto elapsed = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start);
+
+    EXPECT_EQ(handled, burst * bursts);
+    /* One wakeup per message without draining, two per burst with it */
+    EXPECT_EQ(wakeups, bursts * 2);
+    RecordProperty("messages_per_wakeup",
+                   std::to_string(static_cast<double>(handled) / wakeups));
+    RecordProperty("messages_per_sec",
+                   std::to_string(static_cast<uint64_t>(
+                       handled / std::max(elapsed.count(), 1e-9))));
+}
+
+class PDRIndexTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        repo = pldm_pdr_init();
+    }
+
+    void TearDown() override
+    {
+        pldm_pdr_destroy(repo);
+    }
+
+    /* Add a state sensor or effecter PDR with one possible state set */
+    template <typename PDR, typename PossibleStates>
+    void addStatePDR(uint8_t type, uint16_t id, uint16_t entityType,
+                     uint16_t entityInstance, uint16_t stateSetId,
+                     bool remote = false)
+    {
+        std::vector<uint8_t> pdr(sizeof(PDR) - sizeof(uint8_t) +
+                                 sizeof(PossibleStates));
+        auto rec = reinterpret_cast<PDR*>(pdr.data());
+        rec->hdr.type = type;
+        rec->entity_type = entityType;
+        rec->entity_instance = entityInstance;
+        rec->container_id = 1;
+        auto state = reinterpret_cast<PossibleStates*>(rec->possible_states);
+        state->state_set_id = stateSetId;
+        state->possible_states_size = 1;
+        if constexpr (std::is_same_v<PDR, pldm_state_sensor_pdr>)
+        {
+            rec->sensor_id = id;
+            rec->composite_sensor_count = 1;
+        }
+        else
+        {
+            rec->effecter_id = id;
+            rec->composite_effecter_count = 1;
+        }
+
+        uint32_t handle = 0;
+        ASSERT_EQ(pldm_pdr_add_check(repo, pdr.data(), pdr.size(), remote, 1,
+                                     &handle),
+                  0);
+        pdrRepoChanged(repo);
+    }
+
+    void addSensor(uint16_t id, uint16_t entityType, uint16_t entityInstance,
+                   uint16_t stateSetId)
+    {
+        addStatePDR<pldm_state_sensor_pdr, state_sensor_possible_states>(
+            PLDM_STATE_SENSOR_PDR, id, entityType, entityInstance, stateSetId);
+    }
+
+    void addEffecter(uint16_t id, uint16_t entityType, uint16_t entityInstance,
+                     uint16_t stateSetId, bool remote = false)
+    {
+        addStatePDR<pldm_state_effecter_pdr, state_effecter_possible_states>(
+            PLDM_STATE_EFFECTER_PDR, id, entityType, entityInstance,
+            stateSetId, remote);
+    }
+
+    pldm_pdr* repo = nullptr;
+};
+
+TEST_F(PDRIndexTest, lookups)
+{
+    addSensor(1, 5, 0, 10);
+    addSensor(2, 5, 1, 10);
+    addEffecter(3, 5, 0, 11);
+    addEffecter(4, 5, 0, 11, true);
+
+    PDRIndex index(repo);
+    ASSERT_NE(index.getStateSensorPDR(2), nullptr);
+    EXPECT_EQ(index.getStateSensorPDR(2)->entity_instance, 1);
+    EXPECT_EQ(index.getStateSensorPDR(3), nullptr);
+    ASSERT_NE(index.getStateEffecterPDR(3), nullptr);
+    EXPECT_EQ(index.getStateEffecterPDR(1), nullptr);
+    EXPECT_EQ(index.getNumericEffecterPDR(3), nullptr);
+
+    EXPECT_EQ(index.findStateSensorId(5, 1, 1, 10), 2);
+    EXPECT_EQ(index.findStateSensorId(5, 1, 1, 11), PLDM_INVALID_EFFECTER_ID);
+    EXPECT_EQ(index.findStateEffecterId(5, 0, 1, 11, true), 3);
+    EXPECT_EQ(index.findStateEffecterId(5, 0, 1, 11, false), 4);
+
+    /* Same answers as the linear searches */
+    EXPECT_EQ(findStateSensorId(repo, 0, 5, 1, 1, 10), 2);
+    EXPECT_EQ(findStateEffecterId(repo, 5, 0, 1, 11, true), 3);
+    EXPECT_EQ(findStateEffecterId(repo, 5, 0, 1, 11, false), 4);
+}
+
+TEST_F(PDRIndexTest, followsRepoChanges)
+{
+    addSensor(1, 5, 0, 10);
+    PDRIndex index(repo);
+    EXPECT_EQ(index.getStateSensorPDR(2), nullptr);
+
+    addSensor(2, 5, 1, 10);
+    EXPECT_NE(index.getStateSensorPDR(2), nullptr);
+
+    /* Replace the remote records with the same number of records */
+    addEffecter(3, 5, 0, 11, true);
+    EXPECT_NE(index.getStateEffecterPDR(3), nullptr);
+    pldm_pdr_remove_remote_pdrs(repo);
+    pdrRepoChanged(repo);
+    addEffecter(4, 5, 0, 11, true);
+    EXPECT_EQ(index.getStateEffecterPDR(3), nullptr);
+    EXPECT_NE(index.getStateEffecterPDR(4), nullptr);
+}
+
+TEST_F(PDRIndexTest, ignoresTruncatedPossibleStates)
+{
+    /* Two composite states, the second one claims more states than the
+     * record holds */
+    std::vector<uint8_t> pdr(sizeof(pldm_state_sensor_pdr) - sizeof(uint8_t) +
+                             sizeof(state_sensor_possible_states) + 4);
+    auto rec = reinterpret_cast<pldm_state_sensor_pdr*>(pdr.data());
+    rec->hdr.type = PLDM_STATE_SENSOR_PDR;
+    rec->sensor_id = 1;
+    rec->entity_type = 5;
+    rec->container_id = 1;
+    rec->composite_sensor_count = 2;
+    auto state =
+        reinterpret_cast<state_sensor_possible_states*>(rec->possible_states);
+    state->state_set_id = 10;
+    state->possible_states_size = 1;
+    state = reinterpret_cast<state_sensor_possible_states*>(
+        rec->possible_states + sizeof(state_sensor_possible_states));
+    state->state_set_id = 11;
+    state->possible_states_size = 8;
+
+    uint32_t handle = 0;
+    ASSERT_EQ(pldm_pdr_add_check(repo, pdr.data(), pdr.size(), false, 1,
+                                 &handle),
+              0);
+    pdrRepoChanged(repo);
+
+    PDRIndex index(repo);
+    EXPECT_EQ(index.findStateSensorId(5, 0, 1, 10), 1);
+    EXPECT_EQ(index.findStateSensorId(5, 0, 1, 11), PLDM_INVALID_EFFECTER_ID);
+}
+
+TEST_F(PDRIndexTest, lookupsAtFiveThousandPDRs)
+{
+    constexpr uint16_t numPDRs = 5000;
+    for (uint16_t id = 1; id <= numPDRs / 2; id++)
+    {
+        addSensor(id, 5, id, 10);
+        addEffecter(id, 5, id, 11);
+    }
+
+    constexpr size_t lookups = 1000;
+    PDRIndex index(repo);
+    index.getStateSensorPDR(1);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < lookups; i++)
+    {
+        uint16_t id = numPDRs / 2 - i % 100;
+        ASSERT_NE(index.getStateSensorPDR(id), nullptr);
+        ASSERT_EQ(index.findStateEffecterId(5, id, 1, 11, true), id);
+    }
+    auto indexed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now() - start)
+                       .count() /
+                   lookups;
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < lookups; i++)
+    {
+        uint16_t id = numPDRs / 2 - i % 100;
+        ASSERT_EQ(findStateEffecterId(repo, 5, id, 1, 11, true), id);
+    }
+    auto linear = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count() /
+                  lookups;
+
+    RecordProperty("indexed_ns_per_lookup", std::to_string(indexed));
+    RecordProperty("linear_ns_per_lookup", std::to_string(linear));
+    EXPECT_LT(indexed, linear);
+}
@@ -151,6 +151,15 @@ pldm_requester_rc_t PldmTransport::recvMsg(pldm_tid_t& tid, void*& rx,
     return pldm_transport_recv_msg(transport, &tid, (void**)&rx, &len);
 }
 
+pldm_requester_rc_t PldmTransport::recvMsg(pldm_tid_t& tid, PldmRxBuffer& rx,
+                                           size_t& len)
+{
+    void* msg = nullptr;
+    auto rc = recvMsg(tid, msg, len);
+    rx.reset(static_cast<uint8_t*>(msg));
+    return rc;
+}
+
 pldm_requester_rc_t PldmTransport::sendRecvMsg(pldm_tid_t tid, const void* tx,
                                                size_t txLen, void*& rx,
                                                size_t& rxLen)
@@ -4,6 +4,9 @@
 #include <libpldm/pldm.h>
 #include <poll.h>
 #include <stddef.h>
+#include <stdlib.h>
+
+#include <memory>
 
 struct pldm_transport_mctp_demux;
 struct pldm_transport_af_mctp;
@@ -14,6 +17,18 @@ union TransportImpl
     struct pldm_transport_af_mctp* af_mctp;
 };
 
+/** @brief Releases a message buffer allocated by libpldm on receive */
+struct PldmRxBufferFree
+{
+    void operator()(uint8_t* rx) const
+    {
+        free(rx);
+    }
+};
+
+/** @brief Owner of a message received through PldmTransport::recvMsg */
+using PldmRxBuffer = std::unique_ptr<uint8_t, PldmRxBufferFree>;
+
 /* RAII for pldm_transport */
 class PldmTransport
 {
@@ -61,6 +76,19 @@ class PldmTransport
      */
     pldm_requester_rc_t recvMsg(pldm_tid_t& tid, void*& rx, size_t& len);
 
+    /** @brief Asynchronously receive a PLDM message addressed to the local
+     * terminus into a buffer released when the owner goes out of scope
+     *
+     * @param[out] tid - The terminus ID of the message source
+     * @param[out] rx - Owner of the received, encoded message
+     * @param[out] len - The length of the buffer owned by rx
+     *
+     * @return PLDM_REQUESTER_SUCCESS on success, otherwise an appropriate
+     *         PLDM_REQUESTER_* error code.
+     */
+    pldm_requester_rc_t recvMsg(pldm_tid_t& tid, PldmRxBuffer& rx,
+                                size_t& len);
+
     /** @brief Synchronously exchange a request and response with the specified
      * terminus.
      *
@@ -2,8 +2,10 @@
 
 #include <libpldm/pdr.h>
 #include <libpldm/pldm_types.h>
+#include <poll.h>
 
 #include <phosphor-logging/lg2.hpp>
+#include <sdbusplus/bus/match.hpp>
 #include <xyz/openbmc_project/Common/error.hpp>
 #include <xyz/openbmc_project/Logging/Create/client.hpp>
 #include <xyz/openbmc_project/ObjectMapper/client.hpp>
@@ -15,8 +17,10 @@
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 PHOSPHOR_LOG2_USING;
@@ -420,12 +424,170 @@ std::optional<std::vector<set_effecter_state_field>>
     return std::make_optional(std::move(stateField));
 }
 
+std::optional<std::string> DBusServiceCache::get(const std::string& path,
+                                                 const std::string& interface)
+{
+    auto it = services.find({path, interface});
+    if (it == services.end())
+    {
+        misses++;
+        return std::nullopt;
+    }
+    hits++;
+    return it->second;
+}
+
+void DBusServiceCache::set(const std::string& path,
+                           const std::string& interface,
+                           const std::string& service)
+{
+    services[{path, interface}] = service;
+}
+
+void DBusServiceCache::eraseService(const std::string& service)
+{
+    std::erase_if(services, [&service](const auto& entry) {
+        return entry.second == service;
+    });
+}
+
+void DBusServiceCache::eraseInterfaces(
+    const std::string& path, const std::vector<std::string>& interfaces)
+{
+    /* The entries looked up without an interface are always dropped */
+    services.erase({path, ""});
+    if (interfaces.empty())
+    {
+        std::erase_if(services, [&path](const auto& entry) {
+            return entry.first.first == path;
+        });
+        return;
+    }
+    for (const auto& interface : interfaces)
+    {
+        services.erase({path, interface});
+    }
+}
+
+void DBusHandler::enableServiceCache()
+{
+    namespace rules = sdbusplus::bus::match::rules;
+
+    static std::vector<std::unique_ptr<sdbusplus::bus::match_t>> matches;
+    if (!matches.empty())
+    {
+        return;
+    }
+
+    auto& bus = getBus();
+    auto& cache = getServiceCache();
+
+    matches.emplace_back(std::make_unique<sdbusplus::bus::match_t>(
+        bus, rules::nameOwnerChanged(), [&cache](sdbusplus::message_t& msg) {
+        std::string name;
+        std::string oldOwner;
+        std::string newOwner;
+        try
+        {
+            msg.read(name, oldOwner, newOwner);
+        }
+        catch (const sdbusplus::exception_t& e)
+        {
+            cache.clear();
+            return;
+        }
+        cache.eraseService(name);
+        if (!oldOwner.empty())
+        {
+            cache.eraseService(oldOwner);
+        }
+    }));
+
+    matches.emplace_back(std::make_unique<sdbusplus::bus::match_t>(
+        bus, rules::interfacesAdded(), [&cache](sdbusplus::message_t& msg) {
+        sdbusplus::message::object_path path;
+        try
+        {
+            msg.read(path);
+        }
+        catch (const sdbusplus::exception_t& e)
+        {
+            cache.clear();
+            return;
+        }
+        if (!cache.containsPath(path.str))
+        {
+            return;
+        }
+        /* Read the interface names only, skipping their properties */
+        std::vector<std::string> names;
+        auto m = msg.get();
+        auto rc = sd_bus_message_enter_container(m, SD_BUS_TYPE_ARRAY,
+                                                 "{sa{sv}}");
+        while (rc > 0)
+        {
+            rc = sd_bus_message_enter_container(m, SD_BUS_TYPE_DICT_ENTRY,
+                                                "sa{sv}");
+            if (rc <= 0)
+            {
+                break;
+            }
+            const char* name = nullptr;
+            rc = sd_bus_message_read_basic(m, SD_BUS_TYPE_STRING, &name);
+            if (rc > 0)
+            {
+                names.emplace_back(name);
+                rc = sd_bus_message_skip(m, "a{sv}");
+            }
+            if (rc >= 0)
+            {
+                rc = sd_bus_message_exit_container(m);
+            }
+        }
+        if (rc < 0)
+        {
+            /* Malformed payload, drop every interface of the object */
+            cache.eraseInterfaces(path.str, {});
+            return;
+        }
+        cache.eraseInterfaces(path.str, names);
+    }));
+
+    matches.emplace_back(std::make_unique<sdbusplus::bus::match_t>(
+        bus, rules::interfacesRemoved(), [&cache](sdbusplus::message_t& msg) {
+        sdbusplus::message::object_path path;
+        std::vector<std::string> interfaces;
+        try
+        {
+            msg.read(path, interfaces);
+        }
+        catch (const sdbusplus::exception_t& e)
+        {
+            cache.clear();
+            return;
+        }
+        cache.eraseInterfaces(path.str, interfaces);
+    }));
+
+    cache.setEnabled(true);
+}
+
 std::string DBusHandler::getService(const char* path,
                                     const char* interface) const
 {
     using DbusInterfaceList = std::vector<std::string>;
     std::map<std::string, std::vector<std::string>> mapperResponse;
     auto& bus = DBusHandler::getBus();
+    auto& cache = getServiceCache();
+
+    if (cache.isEnabled())
+    {
+        auto service = cache.get(path, interface ? interface : "");
+        if (service)
+        {
+            return *service;
+        }
+    }
 
     auto mapper = bus.new_method_call(ObjectMapper::default_service,
                                       ObjectMapper::instance_path,
@@ -442,6 +604,11 @@ std::string DBusHandler::getService(const char* path,
 
     auto mapperResponseMsg = bus.call(mapper, dbusTimeout);
     mapperResponseMsg.read(mapperResponse);
+    if (cache.isEnabled() && !mapperResponse.empty())
+    {
+        cache.set(path, interface ? interface : "",
+                  mapperResponse.begin()->first);
+    }
     return mapperResponse.begin()->first;
 }
 
@@ -501,7 +668,16 @@ void DBusHandler::setDbusProperty(const DBusMapping& dBusMap,
             service.c_str(), dBusMap.objectPath.c_str(), dbusProperties, "Set");
         method.append(dBusMap.interface.c_str(), dBusMap.propertyName.c_str(),
                       variant);
-        bus.call_noreply(method, dbusTimeout);
+        try
+        {
+            bus.call_noreply(method, dbusTimeout);
+        }
+        catch (const sdbusplus::exception_t& e)
+        {
+            /* Resolve the service again on the next call */
+            getServiceCache().eraseService(service);
+            throw;
+        }
     };
 
     if (dBusMap.propertyType == "uint8_t")
@@ -568,7 +744,16 @@ PropertyValue DBusHandler::getDbusPropertyVariant(
     auto method = bus.new_method_call(service.c_str(), objPath, dbusProperties,
                                       "Get");
     method.append(dbusInterface, dbusProp);
-    return bus.call(method, dbusTimeout).unpack<PropertyValue>();
+    try
+    {
+        return bus.call(method, dbusTimeout).unpack<PropertyValue>();
+    }
+    catch (const sdbusplus::exception_t& e)
+    {
+        /* Resolve the service again on the next call */
+        getServiceCache().eraseService(service);
+        throw;
+    }
 }
 
 PropertyValue jsonEntryToDbusVal(std::string_view type,
@@ -689,38 +874,230 @@ int emitStateSensorEventSignal(uint8_t tid, uint16_t sensorId,
     return PLDM_SUCCESS;
 }
 
-uint16_t findStateSensorId(const pldm_pdr* pdrRepo, uint8_t tid,
+uint16_t findStateSensorId(const pldm_pdr* pdrRepo, uint8_t /*tid*/,
                            uint16_t entityType, uint16_t entityInstance,
                            uint16_t containerId, uint16_t stateSetId)
 {
-    auto pdrs = findStateSensorPDR(tid, entityType, stateSetId, pdrRepo);
-    for (auto pdr : pdrs)
+    uint8_t* pdrData = nullptr;
+    uint32_t pdrSize{};
+    const pldm_pdr_record* record{};
+    do
     {
-        auto sensorPdr = reinterpret_cast<pldm_state_sensor_pdr*>(pdr.data());
-        auto compositeSensorCount = sensorPdr->composite_sensor_count;
-        auto possible_states_start = sensorPdr->possible_states;
-
-        for (auto sensors = 0x00; sensors < compositeSensorCount; sensors++)
+        record = pldm_pdr_find_record_by_type(pdrRepo, PLDM_STATE_SENSOR_PDR,
+                                              record, &pdrData, &pdrSize);
+        if (record)
         {
-            auto possibleStates =
-                reinterpret_cast<state_sensor_possible_states*>(
-                    possible_states_start);
-            auto setId = possibleStates->state_set_id;
-            auto possibleStateSize = possibleStates->possible_states_size;
-            if (entityType == sensorPdr->entity_type &&
-                entityInstance == sensorPdr->entity_instance &&
-                stateSetId == setId && containerId == sensorPdr->container_id)
+            auto pdr = reinterpret_cast<pldm_state_sensor_pdr*>(pdrData);
+            if (entityType != pdr->entity_type ||
+                entityInstance != pdr->entity_instance ||
+                containerId != pdr->container_id)
             {
-                return sensorPdr->sensor_id;
+                continue;
+            }
+
+            auto compositeSensorCount = pdr->composite_sensor_count;
+            auto possible_states_start = pdr->possible_states;
+            for (auto sensors = 0x00; sensors < compositeSensorCount;
+                 sensors++)
+            {
+                auto possibleStates =
+                    reinterpret_cast<state_sensor_possible_states*>(
+                        possible_states_start);
+                auto setId = possibleStates->state_set_id;
+                auto possibleStateSize = possibleStates->possible_states_size;
+                if (stateSetId == setId)
+                {
+                    return pdr->sensor_id;
+                }
+                possible_states_start += possibleStateSize + sizeof(setId) +
+                                         sizeof(possibleStateSize);
             }
-            possible_states_start += possibleStateSize + sizeof(setId) +
-                                     sizeof(possibleStateSize);
         }
-    }
+    } while (record);
+
     return PLDM_INVALID_EFFECTER_ID;
 }
 
-void printBuffer(bool isTx, const std::vector<uint8_t>& buffer)
+namespace
+{
+
+std::unordered_map<const pldm_pdr*, uint64_t>& pdrRepoGenerations()
+{
+    static std::unordered_map<const pldm_pdr*, uint64_t> generations;
+    return generations;
+}
+
+/** @brief Call func with the state set id of each of the composite states
+ *         of a state sensor or effecter PDR
+ */
+template <typename PossibleStates, typename Func>
+void forEachStateSet(const uint8_t* possibleStates, size_t count,
+                     const uint8_t* end, Func func)
+{
+    constexpr size_t headerSize =
+        sizeof(PossibleStates::state_set_id) +
+        sizeof(PossibleStates::possible_states_size);
+    for (size_t i = 0; i < count; i++)
+    {
+        if (static_cast<size_t>(end - possibleStates) < headerSize)
+        {
+            return;
+        }
+        auto states = reinterpret_cast<const PossibleStates*>(possibleStates);
+        size_t statesSize = headerSize + states->possible_states_size;
+        if (static_cast<size_t>(end - possibleStates) < statesSize)
+        {
+            return;
+        }
+        func(states->state_set_id);
+        possibleStates += statesSize;
+    }
+}
+
+} // namespace
+
+void pdrRepoChanged(const pldm_pdr* repo)
+{
+    pdrRepoGenerations()[repo]++;
+}
+
+uint64_t getPDRRepoGeneration(const pldm_pdr* repo)
+{
+    auto& generations = pdrRepoGenerations();
+    auto it = generations.find(repo);
+    return it == generations.end() ? 0 : it->second;
+}
+
+void PDRIndex::refresh()
+{
+    auto currentGeneration = getPDRRepoGeneration(repo);
+    auto currentCount = pldm_pdr_get_record_count(repo);
+    auto currentSize = pldm_pdr_get_repo_size(repo);
+    if (built && generation == currentGeneration &&
+        recordCount == currentCount && repoSize == currentSize)
+    {
+        return;
+    }
+
+    stateSensors.clear();
+    stateEffecters.clear();
+    numericEffecters.clear();
+    stateSensorIds.clear();
+    localEffecterIds.clear();
+    remoteEffecterIds.clear();
+
+    /* The first record wins on duplicates, as with a linear search */
+    uint8_t* data = nullptr;
+    uint32_t size{};
+    const pldm_pdr_record* record{};
+    while ((record = pldm_pdr_find_record_by_type(repo, PLDM_STATE_SENSOR_PDR,
+                                                  record, &data, &size)))
+    {
+        if (size < sizeof(pldm_state_sensor_pdr))
+        {
+            continue;
+        }
+        auto pdr = reinterpret_cast<const pldm_state_sensor_pdr*>(data);
+        stateSensors.emplace(pdr->sensor_id, pdr);
+        forEachStateSet<state_sensor_possible_states>(
+            pdr->possible_states, pdr->composite_sensor_count, data + size,
+            [&](uint16_t stateSetId) {
+            stateSensorIds.emplace(StateKey{pdr->entity_type,
+                                            pdr->entity_instance,
+                                            pdr->container_id, stateSetId},
+                                   pdr->sensor_id);
+        });
+    }
+
+    record = nullptr;
+    while ((record = pldm_pdr_find_record_by_type(
+                repo, PLDM_STATE_EFFECTER_PDR, record, &data, &size)))
+    {
+        if (size < sizeof(pldm_state_effecter_pdr))
+        {
+            continue;
+        }
+        auto pdr = reinterpret_cast<const pldm_state_effecter_pdr*>(data);
+        auto& effecterIds = pldm_pdr_record_is_remote(record)
+                                ? remoteEffecterIds
+                                : localEffecterIds;
+        stateEffecters.emplace(pdr->effecter_id, pdr);
+        forEachStateSet<state_effecter_possible_states>(
+            pdr->possible_states, pdr->composite_effecter_count, data + size,
+            [&](uint16_t stateSetId) {
+            effecterIds.emplace(StateKey{pdr->entity_type,
+                                         pdr->entity_instance,
+                                         pdr->container_id, stateSetId},
+                                pdr->effecter_id);
+        });
+    }
+
+    record = nullptr;
+    while ((record = pldm_pdr_find_record_by_type(
+                repo, PLDM_NUMERIC_EFFECTER_PDR, record, &data, &size)))
+    {
+        if (size < sizeof(pldm_pdr_hdr) + sizeof(uint16_t) * 2)
+        {
+            continue;
+        }
+        auto pdr =
+            reinterpret_cast<const pldm_numeric_effecter_value_pdr*>(data);
+        numericEffecters.emplace(pdr->effecter_id, pdr);
+    }
+
+    built = true;
+    generation = currentGeneration;
+    recordCount = currentCount;
+    repoSize = currentSize;
+}
+
+const pldm_state_sensor_pdr* PDRIndex::getStateSensorPDR(uint16_t sensorId)
+{
+    refresh();
+    auto it = stateSensors.find(sensorId);
+    return it == stateSensors.end() ? nullptr : it->second;
+}
+
+const pldm_state_effecter_pdr*
+    PDRIndex::getStateEffecterPDR(uint16_t effecterId)
+{
+    refresh();
+    auto it = stateEffecters.find(effecterId);
+    return it == stateEffecters.end() ? nullptr : it->second;
+}
+
+const pldm_numeric_effecter_value_pdr*
+    PDRIndex::getNumericEffecterPDR(uint16_t effecterId)
+{
+    refresh();
+    auto it = numericEffecters.find(effecterId);
+    return it == numericEffecters.end() ? nullptr : it->second;
+}
+
+uint16_t PDRIndex::findStateSensorId(uint16_t entityType,
+                                     uint16_t entityInstance,
+                                     uint16_t containerId, uint16_t stateSetId)
+{
+    refresh();
+    auto it = stateSensorIds.find(
+        StateKey{entityType, entityInstance, containerId, stateSetId});
+    return it == stateSensorIds.end() ? PLDM_INVALID_EFFECTER_ID : it->second;
+}
+
+uint16_t PDRIndex::findStateEffecterId(uint16_t entityType,
+                                       uint16_t entityInstance,
+                                       uint16_t containerId,
+                                       uint16_t stateSetId, bool localOrRemote)
+{
+    refresh();
+    const auto& effecterIds = localOrRemote ? localEffecterIds
+                                            : remoteEffecterIds;
+    auto it = effecterIds.find(
+        StateKey{entityType, entityInstance, containerId, stateSetId});
+    return it == effecterIds.end() ? PLDM_INVALID_EFFECTER_ID : it->second;
+}
+
+void printBuffer(bool isTx, std::span<const uint8_t> buffer)
 {
     if (!buffer.empty())
     {
@@ -742,6 +1119,30 @@ void printBuffer(bool isTx, const std::vector<uint8_t>& buffer)
     }
 }
 
+size_t drainReadyMessages(int fd, size_t budget,
+                          const std::function<bool()>& handleMsg)
+{
+    size_t handled = 0;
+    while (handled < budget)
+    {
+        if (handled)
+        {
+            pollfd pfd{fd, POLLIN, 0};
+            if (poll(&pfd, 1, 0) <= 0 || !(pfd.revents & POLLIN))
+            {
+                break;
+            }
+        }
+        handled++;
+        if (!handleMsg())
+        {
+            break;
+        }
+    }
+
+    return handled;
+}
+
 std::string toString(const struct variable_field& var)
 {
     if (var.ptr == nullptr || !var.length)
@@ -19,9 +19,14 @@
 #include <deque>
 #include <exception>
 #include <filesystem>
+#include <functional>
 #include <iostream>
 #include <map>
+#include <optional>
+#include <span>
 #include <string>
+#include <tuple>
+#include <unordered_map>
 #include <variant>
 #include <vector>
 
@@ -193,6 +198,107 @@ using GetSubTreeResponse = std::vector<std::pair<ObjectPath, MapperServiceMap>>;
 using PropertyMap = std::map<std::string, PropertyValue>;
 using InterfaceMap = std::map<std::string, PropertyMap>;
 
+/** @class DBusServiceCache
+ *
+ *  Cache of the D-Bus service names resolved through the ObjectMapper, keyed
+ *  by object path and interface. The entries are dropped when the owner of
+ *  the service changes or the interface is added to or removed from the
+ *  object, see DBusHandler::enableServiceCache.
+ */
+class DBusServiceCache
+{
+  public:
+    /** @brief Look up the cached service of an object path and interface
+     *
+     *  @param[in] path - D-Bus object path
+     *  @param[in] interface - D-Bus interface, empty for any interface
+     *
+     *  @return the service name if it is cached
+     */
+    std::optional<std::string> get(const std::string& path,
+                                   const std::string& interface);
+
+    /** @brief Cache the service of an object path and interface
+     *
+     *  @param[in] path - D-Bus object path
+     *  @param[in] interface - D-Bus interface, empty for any interface
+     *  @param[in] service - D-Bus service name
+     */
+    void set(const std::string& path, const std::string& interface,
+             const std::string& service);
+
+    /** @brief Drop the entries resolved to a service
+     *
+     *  @param[in] service - D-Bus service name
+     */
+    void eraseService(const std::string& service);
+
+    /** @brief Drop the entries of interfaces of an object path
+     *
+     *  @param[in] path - D-Bus object path
+     *  @param[in] interfaces - D-Bus interfaces, empty for every interface
+     */
+    void eraseInterfaces(const std::string& path,
+                         const std::vector<std::string>& interfaces);
+
+    /** @brief Check whether an object path has cached entries
+     *
+     *  @param[in] path - D-Bus object path
+     */
+    bool containsPath(const std::string& path) const
+    {
+        auto it = services.lower_bound({path, ""});
+        return it != services.end() && it->first.first == path;
+    }
+
+    /** @brief Drop all entries */
+    void clear()
+    {
+        services.clear();
+    }
+
+    /** @brief Whether the cache is in use */
+    bool isEnabled() const
+    {
+        return enabled;
+    }
+
+    /** @brief Start or stop using the cache, stopping drops all entries */
+    void setEnabled(bool value)
+    {
+        enabled = value;
+        if (!enabled)
+        {
+            clear();
+        }
+    }
+
+    /** @brief Get the number of cached entries */
+    size_t size() const
+    {
+        return services.size();
+    }
+
+    /** @brief Get the number of lookups answered from the cache */
+    uint64_t getHits() const
+    {
+        return hits;
+    }
+
+    /** @brief Get the number of lookups which were not cached */
+    uint64_t getMisses() const
+    {
+        return misses;
+    }
+
+  private:
+    /** @brief Map of (object path, interface) to the service name */
+    std::map<std::pair<std::string, std::string>, std::string> services;
+    bool enabled = false;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+};
+
 /**
  * @brief The interface for DBusHandler
  */
@@ -234,9 +340,26 @@ class DBusHandler : public DBusHandlerInterface
         return bus;
     }
 
+    /** @brief Get the process wide cache of the resolved service names */
+    static DBusServiceCache& getServiceCache()
+    {
+        static DBusServiceCache cache;
+        return cache;
+    }
+
+    /** @brief Cache the service names resolved by getService
+     *
+     *  @details Installs the NameOwnerChanged, InterfacesAdded and
+     *  InterfacesRemoved matches which keep the cache correct, so it must only
+     *  be called by a process which dispatches the signals of the bus.
+     */
+    static void enableServiceCache();
+
     /**
      *  @brief Get the DBUS Service name for the input dbus path
      *
+     *  @details The name is served from the service cache once it is enabled
+     *
      *  @param[in] path - DBUS object path
      *  @param[in] interface - DBUS Interface
      *
@@ -394,6 +517,107 @@ uint16_t findStateEffecterId(const pldm_pdr* pdrRepo, uint16_t entityType,
                              uint16_t entityInstance, uint16_t containerId,
                              uint16_t stateSetId, bool localOrRemote);
 
+/** @brief Record that PDRs were added to or removed from a PDR repository
+ *
+ *  Invalidates the PDRIndex objects built over the repository.
+ *
+ *  @param[in] repo - PDR repository
+ */
+void pdrRepoChanged(const pldm_pdr* repo);
+
+/** @brief Get the number of changes recorded for a PDR repository
+ *
+ *  @param[in] repo - PDR repository
+ *
+ *  @return uint64_t - the change generation of the repository
+ */
+uint64_t getPDRRepoGeneration(const pldm_pdr* repo);
+
+/** @class PDRIndex
+ *
+ *  Index of the sensor and effecter PDRs of a PDR repository by sensor and
+ *  effecter id and by (entity type, entity instance, container id, state
+ *  set id). The index points into the records of the repository and is
+ *  rebuilt on the first lookup after pdrRepoChanged() is called for the
+ *  repository or its record count or size changed.
+ */
+class PDRIndex
+{
+  public:
+    explicit PDRIndex(const pldm_pdr* repo) : repo(repo) {}
+
+    /** @brief Find a state sensor PDR
+     *  @param[in] sensorId - sensor id
+     *  @return the PDR, nullptr if there is no such sensor
+     */
+    const pldm_state_sensor_pdr* getStateSensorPDR(uint16_t sensorId);
+
+    /** @brief Find a state effecter PDR
+     *  @param[in] effecterId - effecter id
+     *  @return the PDR, nullptr if there is no such effecter
+     */
+    const pldm_state_effecter_pdr* getStateEffecterPDR(uint16_t effecterId);
+
+    /** @brief Find a numeric effecter PDR
+     *  @param[in] effecterId - effecter id
+     *  @return the PDR, nullptr if there is no such effecter
+     */
+    const pldm_numeric_effecter_value_pdr*
+        getNumericEffecterPDR(uint16_t effecterId);
+
+    /** @brief Find sensor id from a state sensor PDR, same as the
+     *         findStateSensorId free function
+     */
+    uint16_t findStateSensorId(uint16_t entityType, uint16_t entityInstance,
+                               uint16_t containerId, uint16_t stateSetId);
+
+    /** @brief Find effecter id from a state effecter PDR, same as the
+     *         findStateEffecterId free function
+     */
+    uint16_t findStateEffecterId(uint16_t entityType, uint16_t entityInstance,
+                                 uint16_t containerId, uint16_t stateSetId,
+                                 bool localOrRemote);
+
+  private:
+    /* entity type, entity instance, container id, state set id */
+    using StateKey = std::tuple<uint16_t, uint16_t, uint16_t, uint16_t>;
+
+    struct StateKeyHash
+    {
+        size_t operator()(const StateKey& key) const
+        {
+            auto [type, instance, container, stateSet] = key;
+            size_t seed = 0;
+            for (uint16_t field : {type, instance, container, stateSet})
+            {
+                seed ^= std::hash<uint16_t>{}(field) + 0x9e3779b9 +
+                        (seed << 6) + (seed >> 2);
+            }
+            return seed;
+        }
+    };
+
+    /** @brief Rebuild the index if the repository changed since it was
+     *         built
+     */
+    void refresh();
+
+    const pldm_pdr* repo;
+    bool built = false;
+    uint64_t generation = 0;
+    uint32_t recordCount = 0;
+    uint32_t repoSize = 0;
+
+    std::unordered_map<uint16_t, const pldm_state_sensor_pdr*> stateSensors;
+    std::unordered_map<uint16_t, const pldm_state_effecter_pdr*>
+        stateEffecters;
+    std::unordered_map<uint16_t, const pldm_numeric_effecter_value_pdr*>
+        numericEffecters;
+    std::unordered_map<StateKey, uint16_t, StateKeyHash> stateSensorIds;
+    std::unordered_map<StateKey, uint16_t, StateKeyHash> localEffecterIds;
+    std::unordered_map<StateKey, uint16_t, StateKeyHash> remoteEffecterIds;
+};
+
 /** @brief Emit the sensor event signal
  *
  *	@param[in] tid - the terminus id
@@ -418,7 +642,24 @@ int emitStateSensorEventSignal(uint8_t tid, uint16_t sensorId,
  *
  *  @return - None
  */
-void printBuffer(bool isTx, const std::vector<uint8_t>& buffer);
+void printBuffer(bool isTx, std::span<const uint8_t> buffer);
+
+/** @brief Handle the messages ready on a file descriptor, up to a budget
+ *
+ *  The first message is handled right away since the caller was woken up
+ *  for it, every further one only if the descriptor polls readable without
+ *  blocking. Bounding the messages handled per wakeup keeps the other event
+ *  sources of the loop served during a burst.
+ *
+ *  @param[in] fd - file descriptor to read the messages from
+ *  @param[in] budget - maximum number of messages to handle
+ *  @param[in] handleMsg - reads and handles one message, returns false to
+ *                         stop draining
+ *
+ *  @return the number of messages handled
+ */
+size_t drainReadyMessages(int fd, size_t budget,
+                          const std::function<bool()>& handleMsg);
 
 /** @brief Convert the buffer to std::string
  *
@@ -7,7 +7,9 @@
 
 #include <phosphor-logging/lg2.hpp>
 
+#include <algorithm>
 #include <functional>
+#include <span>
 
 PHOSPHOR_LOG2_USING;
 
@@ -382,8 +384,8 @@ Response DeviceUpdater::requestFwData(const pldm_msg* request,
     const auto& comp = compImageInfos[applicableComponents[componentIndex]];
     auto compOffset = std::get<5>(comp);
     auto compSize = std::get<6>(comp);
-    error("offset = {OFFSET}, length = {LEN}", "OFFSET", unsigned(offset),
-          "LEN", unsigned(length));
+    debug("RequestFirmwareData, EID={EID}, OFFSET={OFFSET}, LENGTH={LEN}",
+          "EID", unsigned(eid), "OFFSET", offset, "LEN", length);
     if (length < PLDM_FWUP_BASELINE_TRANSFER_SIZE || length > maxTransferSize)
     {
         rc = encode_request_firmware_data_resp(
@@ -398,7 +400,10 @@ Response DeviceUpdater::requestFwData(const pldm_msg* request,
         return response;
     }
 
-    if (offset + length > compSize + PLDM_FWUP_BASELINE_TRANSFER_SIZE)
+    /* Widen before adding, offset comes from the FD and may be near the top
+     * of the range */
+    if (static_cast<uint64_t>(offset) + length >
+        static_cast<uint64_t>(compSize) + PLDM_FWUP_BASELINE_TRANSFER_SIZE)
     {
         rc = encode_request_firmware_data_resp(
             request->hdr.instance_id, PLDM_FWUP_DATA_OUT_OF_RANGE, responseMsg,
@@ -412,19 +417,20 @@ Response DeviceUpdater::requestFwData(const pldm_msg* request,
         return response;
     }
 
-    size_t padBytes = 0;
-    if (offset + length > compSize)
+    /* Bytes past the end of the component image, or past the end of a
+     * truncated package, are sent as zero padding */
+    std::span<const uint8_t> image;
+    if (offset < compSize)
     {
-        padBytes = offset + length - compSize;
+        image = package.slice(static_cast<uint64_t>(compOffset) + offset,
+                              std::min<uint64_t>(length, compSize - offset));
     }
 
     response.resize(sizeof(pldm_msg_hdr) + sizeof(completionCode) + length);
     responseMsg = reinterpret_cast<pldm_msg*>(response.data());
-    package.seekg(compOffset + offset);
-    package.read(reinterpret_cast<char*>(response.data() +
-                                         sizeof(pldm_msg_hdr) +
-                                         sizeof(completionCode)),
-                 length - padBytes);
+    std::copy(image.begin(), image.end(),
+              response.begin() + sizeof(pldm_msg_hdr) +
+                  sizeof(completionCode));
     rc = encode_request_firmware_data_resp(request->hdr.instance_id,
                                            completionCode, responseMsg,
                                            sizeof(completionCode));
@@ -436,6 +442,13 @@ Response DeviceUpdater::requestFwData(const pldm_msg* request,
         return response;
     }
 
+    auto fresh = transferStats[componentIndex].record(offset, length,
+                                                      compSize);
+    if (fresh && updateManager)
+    {
+        updateManager->updateTransferProgress(fresh);
+    }
+
     return response;
 }
 
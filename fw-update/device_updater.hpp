@@ -1,14 +1,14 @@
 #pragma once
 
 #include "common/types.hpp"
+#include "package_image.hpp"
 #include "requester/handler.hpp"
 #include "requester/request.hpp"
+#include "transfer_stats.hpp"
 
 #include <sdeventplus/event.hpp>
 #include <sdeventplus/source/event.hpp>
 
-#include <fstream>
-
 namespace pldm
 {
 
@@ -35,7 +35,7 @@ class DeviceUpdater
     /** @brief Constructor
      *
      *  @param[in] eid - Endpoint ID of the firmware device
-     *  @param[in] package - File stream for firmware update package
+     *  @param[in] package - Mapping of the firmware update package
      *  @param[in] fwDeviceIDRecord - FirmwareDeviceIDRecord in the fw update
      *                                package that matches this firmware device
      *  @param[in] compImageInfos - Component image information for all the
@@ -47,7 +47,7 @@ class DeviceUpdater
      *  @param[in] updateManager - To update the status of fw update of the
      *                             device
      */
-    explicit DeviceUpdater(mctp_eid_t eid, std::ifstream& package,
+    explicit DeviceUpdater(mctp_eid_t eid, const PackageImage& package,
                            const FirmwareDeviceIDRecord& fwDeviceIDRecord,
                            const ComponentImageInfos& compImageInfos,
                            const ComponentInfo& compInfo,
@@ -56,7 +56,9 @@ class DeviceUpdater
         eid(eid),
         package(package), fwDeviceIDRecord(fwDeviceIDRecord),
         compImageInfos(compImageInfos), compInfo(compInfo),
-        maxTransferSize(maxTransferSize), updateManager(updateManager)
+        maxTransferSize(maxTransferSize), updateManager(updateManager),
+        transferStats(
+            std::get<ApplicableComponents>(fwDeviceIDRecord).size())
     {}
 
     /** @brief Start the firmware update flow for the FD
@@ -154,6 +156,28 @@ class DeviceUpdater
     void activateFirmware(mctp_eid_t eid, const pldm_msg* response,
                           size_t respMsgLen);
 
+    /** @brief Get the RequestFirmwareData counters of the components
+     *
+     *  @return the counters, in the order of the applicable components
+     */
+    const std::vector<TransferStats>& getTransferStats() const
+    {
+        return transferStats;
+    }
+
+    /** @brief Get the identifier of an applicable component
+     *
+     *  @param[in] index - index in the applicable components
+     */
+    CompIdentifier getCompIdentifier(size_t index) const
+    {
+        const auto& applicableComponents =
+            std::get<ApplicableComponents>(fwDeviceIDRecord);
+        return std::get<static_cast<size_t>(
+            ComponentImageInfoPos::CompIdentifierPos)>(
+            compImageInfos[applicableComponents[index]]);
+    }
+
   private:
     /** @brief Send PassComponentTable command request
      *
@@ -173,8 +197,8 @@ class DeviceUpdater
     /** @brief Endpoint ID of the firmware device */
     mctp_eid_t eid;
 
-    /** @brief File stream for firmware update package */
-    std::ifstream& package;
+    /** @brief Mapping of the firmware update package */
+    const PackageImage& package;
 
     /** @brief FirmwareDeviceIDRecord in the fw update package that matches this
      *         firmware device
@@ -206,6 +230,9 @@ class DeviceUpdater
      */
     size_t componentIndex = 0;
 
+    /** @brief RequestFirmwareData counters of the applicable components */
+    std::vector<TransferStats> transferStats;
+
     /** @brief To send a PLDM request after the current command handling */
     std::unique_ptr<sdeventplus::source::Defer> pldmRequest;
 };
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <utility>
+
+namespace pldm
+{
+
+namespace fw_update
+{
+
+/** @class PackageImage
+ *
+ *  Read-only mapping of a firmware update package. The package is mapped once
+ *  when it is processed and every firmware device being updated reads its
+ *  component images by slicing the mapping, so concurrent RequestFirmwareData
+ *  commands from several devices neither share a stream position nor copy the
+ *  image through an intermediate buffer.
+ */
+class PackageImage
+{
+  public:
+    PackageImage() = default;
+    PackageImage(const PackageImage&) = delete;
+    PackageImage& operator=(const PackageImage&) = delete;
+
+    PackageImage(PackageImage&& other) noexcept :
+        addr(std::exchange(other.addr, nullptr)),
+        length(std::exchange(other.length, 0)),
+        isOpen(std::exchange(other.isOpen, false))
+    {}
+
+    PackageImage& operator=(PackageImage&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            addr = std::exchange(other.addr, nullptr);
+            length = std::exchange(other.length, 0);
+            isOpen = std::exchange(other.isOpen, false);
+        }
+        return *this;
+    }
+
+    ~PackageImage()
+    {
+        close();
+    }
+
+    /** @brief Map a firmware update package
+     *
+     *  @param[in] path - path of the package
+     *
+     *  @return 0 on success, the errno value of the failing call otherwise
+     */
+    int open(const std::filesystem::path& path)
+    {
+        close();
+
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            return errno;
+        }
+
+        struct stat st
+        {};
+        if (fstat(fd, &st) < 0)
+        {
+            auto rc = errno;
+            ::close(fd);
+            return rc;
+        }
+
+        /* An empty package is valid to map, it fails the size checks later */
+        if (st.st_size > 0)
+        {
+            auto mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd,
+                               0);
+            if (mapped == MAP_FAILED)
+            {
+                auto rc = errno;
+                ::close(fd);
+                return rc;
+            }
+            addr = static_cast<uint8_t*>(mapped);
+            length = st.st_size;
+        }
+        isOpen = true;
+
+        /* The mapping keeps the file referenced */
+        ::close(fd);
+        return 0;
+    }
+
+    /** @brief Unmap the package */
+    void close()
+    {
+        if (addr)
+        {
+            munmap(addr, length);
+        }
+        addr = nullptr;
+        length = 0;
+        isOpen = false;
+    }
+
+    /** @brief Check whether a package is mapped */
+    bool good() const
+    {
+        return isOpen;
+    }
+
+    /** @brief Get the size of the package in bytes */
+    size_t size() const
+    {
+        return length;
+    }
+
+    /** @brief Get the bytes of the package */
+    std::span<const uint8_t> data() const
+    {
+        return {addr, length};
+    }
+
+    /** @brief Get a range of the package
+     *
+     *  @param[in] offset - offset of the range in the package
+     *  @param[in] count - length of the range
+     *
+     *  @return the part of the range which lies within the package, it is
+     *          shorter than count when the range runs past the end
+     */
+    std::span<const uint8_t> slice(uint64_t offset, uint64_t count) const
+    {
+        if (offset >= length)
+        {
+            return {};
+        }
+        return data().subspan(offset, std::min<uint64_t>(count,
+                                                         length - offset));
+    }
+
+  private:
+    uint8_t* addr = nullptr;
+    size_t length = 0;
+    bool isOpen = false;
+};
+
+} // namespace fw_update
+
+} // namespace pldm
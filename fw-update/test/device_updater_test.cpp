@@ -6,6 +6,14 @@
 
 #include <libpldm/firmware_update.h>
 
+#include <endian.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -15,9 +23,9 @@ using namespace pldm::fw_update;
 class DeviceUpdaterTest : public testing::Test
 {
   protected:
-    DeviceUpdaterTest() :
-        package("./test_pkg", std::ios::binary | std::ios::in | std::ios::ate)
+    DeviceUpdaterTest()
     {
+        EXPECT_EQ(package.open("./test_pkg"), 0);
         fwDeviceIDRecord = {
             1,
             {0x00},
@@ -32,8 +40,7 @@ class DeviceUpdaterTest : public testing::Test
         compInfo = {{std::make_pair(10, 100), 1}};
     }
 
-    int fd = -1;
-    std::ifstream package;
+    PackageImage package;
     FirmwareDeviceIDRecord fwDeviceIDRecord;
     ComponentImageInfos compImageInfos;
     ComponentInfo compInfo;
@@ -42,32 +49,22 @@ class DeviceUpdaterTest : public testing::Test
 TEST_F(DeviceUpdaterTest, validatePackage)
 {
     constexpr uintmax_t testPkgSize = 1163;
-    uintmax_t packageSize = package.tellg();
+    uintmax_t packageSize = package.size();
     EXPECT_EQ(packageSize, testPkgSize);
 
-    package.seekg(0);
-    std::vector<uint8_t> packageHeader(sizeof(pldm_package_header_information));
-    package.read(reinterpret_cast<char*>(packageHeader.data()),
-                 sizeof(pldm_package_header_information));
-
     auto pkgHeaderInfo =
         reinterpret_cast<const pldm_package_header_information*>(
-            packageHeader.data());
+            package.data().data());
     auto pkgHeaderInfoSize = sizeof(pldm_package_header_information) +
                              pkgHeaderInfo->package_version_string_length;
-    packageHeader.clear();
-    packageHeader.resize(pkgHeaderInfoSize);
-    package.seekg(0);
-    package.read(reinterpret_cast<char*>(packageHeader.data()),
-                 pkgHeaderInfoSize);
+    auto headerInfo = package.slice(0, pkgHeaderInfoSize);
+    std::vector<uint8_t> packageHeader(headerInfo.begin(), headerInfo.end());
 
     auto parser = parsePkgHeader(packageHeader);
     EXPECT_NE(parser, nullptr);
 
-    package.seekg(0);
-    packageHeader.resize(parser->pkgHeaderSize);
-    package.read(reinterpret_cast<char*>(packageHeader.data()),
-                 parser->pkgHeaderSize);
+    auto header = package.slice(0, parser->pkgHeaderSize);
+    packageHeader.assign(header.begin(), header.end());
 
     parser->parse(packageHeader, packageSize);
     const auto& fwDeviceIDRecords = parser->getFwDeviceIDRecords();
@@ -150,3 +147,213 @@ TEST_F(DeviceUpdaterTest, ReadPackage512B)
         0xA2, 0x72, 0x33, 0x00, 0x3C, 0x7E, 0x28, 0x36, 0x10, 0x90, 0x38, 0xFB};
     EXPECT_EQ(response, compFirst512B);
 }
+
+namespace
+{
+
+/** @brief Encode a RequestFirmwareData request */
+std::vector<uint8_t> reqFwData(uint8_t instanceId, uint32_t offset,
+                               uint32_t length)
+{
+    std::vector<uint8_t> request(sizeof(pldm_msg_hdr) +
+                                 sizeof(pldm_request_firmware_data_req));
+    auto msg = reinterpret_cast<pldm_msg*>(request.data());
+    msg->hdr.request = PLDM_REQUEST;
+    msg->hdr.instance_id = instanceId;
+    msg->hdr.type = PLDM_FWUP;
+    msg->hdr.command = PLDM_REQUEST_FIRMWARE_DATA;
+    auto req =
+        reinterpret_cast<pldm_request_firmware_data_req*>(msg->payload);
+    req->offset = htole32(offset);
+    req->length = htole32(length);
+    return request;
+}
+
+} // namespace
+
+TEST_F(DeviceUpdaterTest, ReadPackagePadding)
+{
+    DeviceUpdater deviceUpdater(0, package, fwDeviceIDRecord, compImageInfos,
+                                compInfo, 512, nullptr);
+
+    /* The last 16 bytes of the 1024 byte component and 16 bytes of padding */
+    auto request = reqFwData(1, 1008, PLDM_FWUP_BASELINE_TRANSFER_SIZE);
+    auto response = deviceUpdater.requestFwData(
+        reinterpret_cast<const pldm_msg*>(request.data()),
+        sizeof(pldm_request_firmware_data_req));
+
+    constexpr auto dataOffset = sizeof(pldm_msg_hdr) + sizeof(uint8_t);
+    ASSERT_EQ(response.size(), dataOffset + PLDM_FWUP_BASELINE_TRANSFER_SIZE);
+    EXPECT_EQ(response[sizeof(pldm_msg_hdr)], PLDM_SUCCESS);
+    auto image = package.slice(139 + 1008, 16);
+    ASSERT_EQ(image.size(), 16);
+    EXPECT_TRUE(std::equal(image.begin(), image.end(),
+                           response.begin() + dataOffset));
+    EXPECT_TRUE(std::all_of(response.begin() + dataOffset + 16, response.end(),
+                            [](uint8_t byte) { return byte == 0; }));
+}
+
+TEST_F(DeviceUpdaterTest, ReadPackageOutOfRange)
+{
+    DeviceUpdater deviceUpdater(0, package, fwDeviceIDRecord, compImageInfos,
+                                compInfo, 512, nullptr);
+
+    /* Past the padding allowed after the component */
+    auto request = reqFwData(1, 1024, 64);
+    auto response = deviceUpdater.requestFwData(
+        reinterpret_cast<const pldm_msg*>(request.data()),
+        sizeof(pldm_request_firmware_data_req));
+    ASSERT_EQ(response.size(), sizeof(pldm_msg_hdr) + sizeof(uint8_t));
+    EXPECT_EQ(response[sizeof(pldm_msg_hdr)], PLDM_FWUP_DATA_OUT_OF_RANGE);
+
+    /* An offset wrapping around when the length is added */
+    request = reqFwData(1, 0xFFFFFFF0, 64);
+    response = deviceUpdater.requestFwData(
+        reinterpret_cast<const pldm_msg*>(request.data()),
+        sizeof(pldm_request_firmware_data_req));
+    ASSERT_EQ(response.size(), sizeof(pldm_msg_hdr) + sizeof(uint8_t));
+    EXPECT_EQ(response[sizeof(pldm_msg_hdr)], PLDM_FWUP_DATA_OUT_OF_RANGE);
+}
+
+TEST(DeviceUpdaterThroughput, concurrentDevices)
+{
+    constexpr size_t devices = 8;
+    constexpr uint32_t compSize = 1024 * 1024;
+    constexpr uint32_t maxTransferSize = 4096;
+
+    char path[] = "/tmp/fw_package_test.XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_NE(fd, -1);
+    close(fd);
+    {
+        std::ofstream file(path, std::ios::binary);
+        for (size_t i = 0; i < devices * compSize; i++)
+        {
+            file.put(static_cast<char>(i * 7 + i / compSize));
+        }
+    }
+
+    PackageImage package;
+    ASSERT_EQ(package.open(path), 0);
+    std::remove(path);
+
+    ComponentImageInfos compImageInfos;
+    std::vector<FirmwareDeviceIDRecord> records;
+    for (size_t i = 0; i < devices; i++)
+    {
+        compImageInfos.emplace_back(
+            10, static_cast<CompIdentifier>(100 + i), 0xFFFFFFFF, 0, 0,
+            static_cast<CompLocationOffset>(i * compSize), compSize,
+            "Version");
+        records.emplace_back(
+            1, ApplicableComponents{i}, "Version", Descriptors{},
+            FirmwareDevicePackageData{});
+    }
+    ComponentInfo compInfo;
+    std::vector<std::unique_ptr<DeviceUpdater>> updaters;
+    for (size_t i = 0; i < devices; i++)
+    {
+        updaters.emplace_back(std::make_unique<DeviceUpdater>(
+            i, package, records[i], compImageInfos, compInfo,
+            maxTransferSize, nullptr));
+    }
+
+    /* Every device pulls its component at the maximum transfer size, the
+     * requests interleave the way they do when devices update together */
+    size_t bytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t offset = 0; offset < compSize; offset += maxTransferSize)
+    {
+        auto request = reqFwData(1, offset, maxTransferSize);
+        for (size_t i = 0; i < devices; i++)
+        {
+            auto response = updaters[i]->requestFwData(
+                reinterpret_cast<const pldm_msg*>(request.data()),
+                sizeof(pldm_request_firmware_data_req));
+            ASSERT_EQ(response.size(), sizeof(pldm_msg_hdr) + 1 +
+                                           maxTransferSize);
+            auto expected = package.slice(i * compSize + offset,
+                                          maxTransferSize);
+            ASSERT_TRUE(std::equal(expected.begin(), expected.end(),
+                                   response.begin() + sizeof(pldm_msg_hdr) +
+                                       1));
+            bytes += maxTransferSize;
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    EXPECT_EQ(bytes, devices * compSize);
+    auto mbPerSec = elapsed.count() ? bytes / elapsed.count() : bytes;
+    RecordProperty("devices", std::to_string(devices));
+    RecordProperty("transfer_size", std::to_string(maxTransferSize));
+    RecordProperty("mb_per_sec", std::to_string(mbPerSec));
+}
+
+TEST_F(DeviceUpdaterTest, TransferStats)
+{
+    DeviceUpdater deviceUpdater(0, package, fwDeviceIDRecord, compImageInfos,
+                                compInfo, 512, nullptr);
+    ASSERT_EQ(deviceUpdater.getTransferStats().size(), 1);
+    EXPECT_EQ(deviceUpdater.getCompIdentifier(0), 100);
+
+    for (uint32_t offset : {0, 512, 512, 1008})
+    {
+        auto request = reqFwData(1, offset, offset == 1008 ? 32 : 512);
+        deviceUpdater.requestFwData(
+            reinterpret_cast<const pldm_msg*>(request.data()),
+            sizeof(pldm_request_firmware_data_req));
+    }
+    /* Rejected requests are not counted */
+    auto request = reqFwData(1, 2048, 512);
+    deviceUpdater.requestFwData(
+        reinterpret_cast<const pldm_msg*>(request.data()),
+        sizeof(pldm_request_firmware_data_req));
+
+    const auto& stats = deviceUpdater.getTransferStats()[0];
+    EXPECT_EQ(stats.getRequests(), 4);
+    EXPECT_EQ(stats.getBytesServed(), 512 * 3 + 32);
+    EXPECT_EQ(stats.getRetransmits(), 2);
+    EXPECT_EQ(stats.getTransferred(), 1024);
+}
+
+TEST(TransferStats, interarrival)
+{
+    using namespace std::chrono_literals;
+    TransferStats stats;
+    TransferStats::Clock::time_point now{};
+
+    EXPECT_EQ(stats.record(0, 100, 1000, now), 100);
+    EXPECT_EQ(stats.getMeanInterarrivalUs(), 0);
+    EXPECT_EQ(stats.getP99InterarrivalUs(), 0);
+
+    /* 99 fast requests and one slow one */
+    uint32_t offset = 100;
+    for (int i = 0; i < 99; i++)
+    {
+        now += 10us;
+        stats.record(offset, 1, 1000, now);
+        offset++;
+    }
+    now += 5000us;
+    stats.record(offset, 1, 1000, now);
+
+    EXPECT_EQ(stats.getRequests(), 101);
+    EXPECT_EQ(stats.getMeanInterarrivalUs(), (99 * 10 + 5000) / 100);
+    /* The 99th of 100 samples is one of the fast ones */
+    EXPECT_EQ(stats.getP99InterarrivalUs(), 15);
+    EXPECT_EQ(stats.getBytesPerSec(), 200 * 1000000 / 5990);
+}
+
+TEST(TransferStats, progress)
+{
+    TransferStats stats;
+    EXPECT_EQ(stats.record(0, 64, 100), 64);
+    /* Only the bytes within the image count, not the padding */
+    EXPECT_EQ(stats.record(64, 64, 100), 36);
+    EXPECT_EQ(stats.getTransferred(), 100);
+    /* Requested again, nothing new */
+    EXPECT_EQ(stats.record(32, 64, 100), 0);
+    EXPECT_EQ(stats.getRetransmits(), 1);
+    EXPECT_EQ(stats.getBytesServed(), 192);
+}
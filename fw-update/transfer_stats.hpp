@@ -0,0 +1,132 @@
+#pragma once
+
+#include "common/histogram.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+namespace pldm
+{
+
+namespace fw_update
+{
+
+/** @class TransferStats
+ *
+ *  Counters of the RequestFirmwareData commands of one component image sent
+ *  by a firmware device. They tell apart a slow FD, which shows as a long time
+ *  between requests, from a lossy link, which shows as offsets requested again.
+ */
+class TransferStats
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    /** @brief Record a RequestFirmwareData command
+     *
+     *  @param[in] offset - offset requested in the component image
+     *  @param[in] length - number of bytes requested
+     *  @param[in] compSize - size of the component image
+     *  @param[in] now - time the request was received
+     *
+     *  @return the number of bytes of the image served for the first time
+     */
+    uint32_t record(uint32_t offset, uint32_t length, uint32_t compSize,
+                    Clock::time_point now = Clock::now())
+    {
+        if (requests)
+        {
+            auto us = std::chrono::duration_cast<std::chrono::microseconds>(
+                          now - last)
+                          .count();
+            interarrivalSumUs += static_cast<uint64_t>(us > 0 ? us : 0);
+            interarrivals.record(now - last);
+        }
+        else
+        {
+            first = now;
+        }
+        last = now;
+        requests++;
+        bytesServed += length;
+
+        if (offset < transferred)
+        {
+            retransmits++;
+        }
+        auto end = std::min<uint64_t>(static_cast<uint64_t>(offset) + length,
+                                      compSize);
+        if (end <= transferred)
+        {
+            return 0;
+        }
+        auto fresh = static_cast<uint32_t>(end - transferred);
+        transferred = static_cast<uint32_t>(end);
+        return fresh;
+    }
+
+    /** @brief Get the number of bytes sent, padding included */
+    uint64_t getBytesServed() const
+    {
+        return bytesServed;
+    }
+
+    /** @brief Get the number of RequestFirmwareData commands */
+    uint64_t getRequests() const
+    {
+        return requests;
+    }
+
+    /** @brief Get the number of requests for offsets already sent */
+    uint64_t getRetransmits() const
+    {
+        return retransmits;
+    }
+
+    /** @brief Get the furthest end of the image sent so far */
+    uint32_t getTransferred() const
+    {
+        return transferred;
+    }
+
+    /** @brief Get the rate the bytes were served at, between the first and
+     *         the latest request
+     */
+    uint64_t getBytesPerSec() const
+    {
+        auto us =
+            std::chrono::duration_cast<std::chrono::microseconds>(last - first)
+                .count();
+        return us > 0 ? bytesServed * 1000000 / us : 0;
+    }
+
+    /** @brief Get the mean time between two requests in microseconds */
+    uint64_t getMeanInterarrivalUs() const
+    {
+        return requests > 1 ? interarrivalSumUs / (requests - 1) : 0;
+    }
+
+    /** @brief Get an upper bound of the 99th percentile of the time between
+     *         two requests in microseconds
+     */
+    uint64_t getP99InterarrivalUs() const
+    {
+        return interarrivals.getPercentile(99);
+    }
+
+  private:
+    uint64_t bytesServed = 0;
+    uint64_t requests = 0;
+    uint64_t retransmits = 0;
+    /** @brief Furthest end of the image sent so far */
+    uint32_t transferred = 0;
+    uint64_t interarrivalSumUs = 0;
+    pldm::utils::Log2Histogram interarrivals;
+    Clock::time_point first;
+    Clock::time_point last;
+};
+
+} // namespace fw_update
+
+} // namespace pldm
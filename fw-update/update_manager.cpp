@@ -6,10 +6,10 @@
 
 #include <phosphor-logging/lg2.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <filesystem>
-#include <fstream>
 #include <string>
 
 PHOSPHOR_LOG2_USING;
@@ -51,19 +51,18 @@ int UpdateManager::processPackage(const std::filesystem::path& packageFilePath)
         }
     }
 
-    package.open(packageFilePath,
-                 std::ios::binary | std::ios::in | std::ios::ate);
-    if (!package.good())
+    auto rc = package.open(packageFilePath);
+    if (rc)
     {
         error(
             "Opening the PLDM FW update package failed, ERR={ERR}, PACKAGEFILE={PKG_FILE}",
-            "ERR", unsigned(errno), "PKG_FILE", packageFilePath.c_str());
+            "ERR", unsigned(rc), "PKG_FILE", packageFilePath.c_str());
         package.close();
         std::filesystem::remove(packageFilePath);
         return -1;
     }
 
-    uintmax_t packageSize = package.tellg();
+    uintmax_t packageSize = package.size();
     if (packageSize < sizeof(pldm_package_header_information))
     {
         error(
@@ -74,21 +73,13 @@ int UpdateManager::processPackage(const std::filesystem::path& packageFilePath)
         return -1;
     }
 
-    package.seekg(0);
-    std::vector<uint8_t> packageHeader(sizeof(pldm_package_header_information));
-    package.read(reinterpret_cast<char*>(packageHeader.data()),
-                 sizeof(pldm_package_header_information));
-
     auto pkgHeaderInfo =
         reinterpret_cast<const pldm_package_header_information*>(
-            packageHeader.data());
+            package.data().data());
     auto pkgHeaderInfoSize = sizeof(pldm_package_header_information) +
                              pkgHeaderInfo->package_version_string_length;
-    packageHeader.clear();
-    packageHeader.resize(pkgHeaderInfoSize);
-    package.seekg(0);
-    package.read(reinterpret_cast<char*>(packageHeader.data()),
-                 pkgHeaderInfoSize);
+    auto headerInfo = package.slice(0, pkgHeaderInfoSize);
+    std::vector<uint8_t> packageHeader(headerInfo.begin(), headerInfo.end());
 
     parser = parsePkgHeader(packageHeader);
     if (parser == nullptr)
@@ -103,10 +94,8 @@ int UpdateManager::processPackage(const std::filesystem::path& packageFilePath)
     size_t versionHash = std::hash<std::string>{}(parser->pkgVersion);
     objPath = swRootPath + std::to_string(versionHash);
 
-    package.seekg(0);
-    packageHeader.resize(parser->pkgHeaderSize);
-    package.read(reinterpret_cast<char*>(packageHeader.data()),
-                 parser->pkgHeaderSize);
+    auto header = package.slice(0, parser->pkgHeaderSize);
+    packageHeader.assign(header.begin(), header.end());
     try
     {
         parser->parse(packageHeader, packageSize);
@@ -144,6 +133,11 @@ int UpdateManager::processPackage(const std::filesystem::path& packageFilePath)
     {
         const auto& fwDeviceIDRecord =
             fwDeviceIDRecords[deviceUpdaterInfo.second];
+        for (auto index : std::get<ApplicableComponents>(fwDeviceIDRecord))
+        {
+            totalTransferBytes += std::get<static_cast<size_t>(
+                ComponentImageInfoPos::CompSizePos)>(compImageInfos[index]);
+        }
         auto search = componentInfoMap.find(deviceUpdaterInfo.first);
         deviceUpdaterMap.emplace(
             deviceUpdaterInfo.first,
@@ -158,6 +152,9 @@ int UpdateManager::processPackage(const std::filesystem::path& packageFilePath)
         software::Activation::Activations::Ready, this);
     activationProgress = std::make_unique<ActivationProgress>(
         pldm::utils::DBusHandler::getBus(), objPath);
+    transferStats = std::make_unique<pldm::dbus_api::DebugStats>(
+        pldm::utils::DBusHandler::getBus(), objPath,
+        [this]() { return getTransferCounters(); });
 
     return 0;
 }
@@ -207,7 +204,11 @@ void UpdateManager::updateDeviceCompletion(mctp_eid_t eid, bool status)
         auto dur =
             std::chrono::duration<double, std::milli>(endTime - startTime)
                 .count();
-        error("Firmware update time: {DURATION}ms", "DURATION", dur);
+        error(
+            "Firmware update time: {DURATION}ms, BYTES={BYTES}, RATE={RATE}B/s",
+            "DURATION", dur, "BYTES", transferredBytes, "RATE",
+            dur > 0 ? static_cast<uint64_t>(transferredBytes * 1000 / dur)
+                    : 0);
         activation->activation(software::Activation::Activations::Active);
     }
     return;
@@ -268,6 +269,7 @@ void UpdateManager::activatePackage()
 
 void UpdateManager::clearActivationInfo()
 {
+    transferStats.reset();
     activation.reset();
     activationProgress.reset();
     objPath.clear();
@@ -279,16 +281,79 @@ void UpdateManager::clearActivationInfo()
     std::filesystem::remove(fwPackageFilePath);
     totalNumComponentUpdates = 0;
     compUpdateCompletedCount = 0;
+    totalTransferBytes = 0;
+    transferredBytes = 0;
 }
 
 void UpdateManager::updateActivationProgress()
 {
     compUpdateCompletedCount++;
-    auto progressPercent = static_cast<uint8_t>(std::floor(
-        (100 * compUpdateCompletedCount) / totalNumComponentUpdates));
+    setActivationProgress();
+}
+
+void UpdateManager::updateTransferProgress(uint64_t bytes)
+{
+    transferredBytes += bytes;
+    setActivationProgress();
+}
+
+void UpdateManager::setActivationProgress()
+{
+    if (!activationProgress)
+    {
+        return;
+    }
+
+    uint8_t progressPercent = 100;
+    if (compUpdateCompletedCount < totalNumComponentUpdates)
+    {
+        // Follow the bytes transferred, holding back the last percent until
+        // every component is applied
+        if (totalTransferBytes)
+        {
+            progressPercent = static_cast<uint8_t>(std::min<uint64_t>(
+                99, 100 * transferredBytes / totalTransferBytes));
+        }
+        else
+        {
+            progressPercent = static_cast<uint8_t>(std::floor(
+                (100 * compUpdateCompletedCount) / totalNumComponentUpdates));
+        }
+    }
     activationProgress->progress(progressPercent);
 }
 
+pldm::dbus_api::DebugStats::Counters UpdateManager::getTransferCounters() const
+{
+    pldm::dbus_api::DebugStats::Counters counters{
+        {"BytesTotal", totalTransferBytes},
+        {"BytesTransferred", transferredBytes},
+        {"TransferPercent",
+         totalTransferBytes ? 100 * transferredBytes / totalTransferBytes : 0}};
+
+    for (const auto& [eid, deviceUpdater] : deviceUpdaterMap)
+    {
+        const auto& stats = deviceUpdater->getTransferStats();
+        for (size_t index = 0; index < stats.size(); index++)
+        {
+            auto prefix = "EID" + std::to_string(eid) + ".Component" +
+                          std::to_string(
+                              deviceUpdater->getCompIdentifier(index)) +
+                          ".";
+            const auto& comp = stats[index];
+            counters.emplace(prefix + "BytesServed", comp.getBytesServed());
+            counters.emplace(prefix + "BytesPerSec", comp.getBytesPerSec());
+            counters.emplace(prefix + "Requests", comp.getRequests());
+            counters.emplace(prefix + "Retransmits", comp.getRetransmits());
+            counters.emplace(prefix + "MeanInterarrivalUs",
+                             comp.getMeanInterarrivalUs());
+            counters.emplace(prefix + "P99InterarrivalUs",
+                             comp.getP99InterarrivalUs());
+        }
+    }
+    return counters;
+}
+
 } // namespace fw_update
 
 } // namespace pldm
@@ -3,7 +3,9 @@
 #include "common/instance_id.hpp"
 #include "common/types.hpp"
 #include "device_updater.hpp"
+#include "package_image.hpp"
 #include "package_parser.hpp"
+#include "pldmd/dbus_impl_debug.hpp"
 #include "requester/handler.hpp"
 #include "watch.hpp"
 
@@ -11,7 +13,6 @@
 
 #include <chrono>
 #include <filesystem>
-#include <fstream>
 #include <tuple>
 #include <unordered_map>
 
@@ -74,6 +75,18 @@ class UpdateManager
 
     void updateActivationProgress();
 
+    /** @brief Account for component image bytes sent to an FD for the first
+     *         time in the activation progress
+     *
+     *  @param[in] bytes - number of bytes
+     */
+    void updateTransferProgress(uint64_t bytes);
+
+    /** @brief Collect the firmware transfer counters of the FDs being
+     *         updated, exposed on the Activation object
+     */
+    pldm::dbus_api::DebugStats::Counters getTransferCounters() const;
+
     /** @brief Callback function that will be invoked when the
      *         RequestedActivation will be set to active in the Activation
      *         interface
@@ -109,7 +122,7 @@ class UpdateManager
 
     std::filesystem::path fwPackageFilePath;
     std::unique_ptr<PackageParser> parser;
-    std::ifstream package;
+    PackageImage package;
 
     std::unordered_map<mctp_eid_t, std::unique_ptr<DeviceUpdater>>
         deviceUpdaterMap;
@@ -127,6 +140,22 @@ class UpdateManager
      */
     size_t compUpdateCompletedCount;
     decltype(std::chrono::steady_clock::now()) startTime;
+
+    /** @brief Size of the component images of all the component updates */
+    uint64_t totalTransferBytes = 0;
+
+    /** @brief Bytes of component images sent so far, the activation progress
+     *         follows them until the components are applied
+     */
+    uint64_t transferredBytes = 0;
+
+    /** @brief Firmware transfer counters on the Activation object */
+    std::unique_ptr<pldm::dbus_api::DebugStats> transferStats;
+
+    /** @brief Set the activation progress from the bytes transferred and the
+     *         components applied
+     */
+    void setActivationProgress();
 };
 
 } // namespace fw_update
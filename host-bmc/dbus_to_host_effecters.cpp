@@ -169,32 +169,87 @@ void HostEffecterParser::parseEffecterJson(const std::string& jsonPath)
     }
 }
 
-bool HostEffecterParser::isHostOn(void)
+using BootProgress =
+    sdbusplus::client::xyz::openbmc_project::state::boot::Progress<>;
+
+constexpr auto hostStatePath = "/xyz/openbmc_project/state/host0";
+
+/* @brief Check whether a BootProgress value is one of a host that is up
+ *
+ * @param[in] progress - BootProgress property value
+ * @return - true if the host is up
+ */
+static bool isHostUp(const std::string& progress)
 {
-    using BootProgress =
-        sdbusplus::client::xyz::openbmc_project::state::boot::Progress<>;
+    using Stages = BootProgress::ProgressStages;
+    auto currHostState =
+        sdbusplus::message::convert_from_string<Stages>(progress).value();
+
+    if (currHostState != Stages::SystemInitComplete &&
+        currHostState != Stages::OSRunning &&
+        currHostState != Stages::SystemSetup && currHostState != Stages::OEM)
+    {
+        info("Host is not up. Current host state: {CUR_HOST_STATE}",
+             "CUR_HOST_STATE", currHostState);
+        return false;
+    }
+    return true;
+}
 
-    constexpr auto hostStatePath = "/xyz/openbmc_project/state/host0";
+void HostEffecterParser::createHostStateMatch()
+{
+    namespace rules = sdbusplus::bus::match::rules;
+    hostStateMatch = std::make_unique<sdbusplus::bus::match_t>(
+        pldm::utils::DBusHandler::getBus(),
+        rules::propertiesChanged(hostStatePath, BootProgress::interface),
+        [this](sdbusplus::message_t& msg) {
+        DbusChgHostEffecterProps props;
+        std::string iface;
+        msg.read(iface, props);
+        const auto it = props.find("BootProgress");
+        if (it == props.end())
+        {
+            return;
+        }
+        try
+        {
+            hostOn = isHostUp(std::get<std::string>(it->second));
+        }
+        catch (const std::exception& e)
+        {
+            error("Invalid BootProgress value - {ERR_EXCEP}", "ERR_EXCEP",
+                  e.what());
+            hostOn.reset();
+            return;
+        }
+        if (!*hostOn)
+        {
+            /* The values held were not to be sent to a host that is down */
+            for (auto& [key, write] : effecterWrites)
+            {
+                write.pending = false;
+            }
+        }
+    });
+}
+
+bool HostEffecterParser::isHostOn(void)
+{
+    /* Subscribe before reading so that no change is missed */
+    if (!hostStateMatch)
+    {
+        createHostStateMatch();
+    }
+    if (hostOn)
+    {
+        return *hostOn;
+    }
 
     try
     {
         auto propVal = dbusHandler->getDbusPropertyVariant(
             hostStatePath, "BootProgress", BootProgress::interface);
-
-        using Stages = BootProgress::ProgressStages;
-        auto currHostState = sdbusplus::message::convert_from_string<Stages>(
-                                 std::get<std::string>(propVal))
-                                 .value();
-
-        if (currHostState != Stages::SystemInitComplete &&
-            currHostState != Stages::OSRunning &&
-            currHostState != Stages::SystemSetup &&
-            currHostState != Stages::OEM)
-        {
-            info("Host is not up. Current host state: {CUR_HOST_STATE}",
-                 "CUR_HOST_STATE", currHostState);
-            return false;
-        }
+        hostOn = isHostUp(std::get<std::string>(propVal));
     }
     catch (const sdbusplus::exception_t& e)
     {
@@ -204,7 +259,7 @@ bool HostEffecterParser::isHostOn(void)
         return false;
     }
 
-    return true;
+    return *hostOn;
 }
 
 void HostEffecterParser::processHostEffecterChangeNotification(
@@ -232,8 +287,8 @@ void HostEffecterParser::processHostEffecterChangeNotification(
     if (effecterId == PLDM_INVALID_EFFECTER_ID)
     {
         constexpr auto localOrRemote = false;
-        effecterId = findStateEffecterId(
-            pdrRepo, hostEffecterInfo[effecterInfoIndex].entityType,
+        effecterId = pdrIndex.findStateEffecterId(
+            hostEffecterInfo[effecterInfoIndex].entityType,
             hostEffecterInfo[effecterInfoIndex].entityInstance,
             hostEffecterInfo[effecterInfoIndex].containerId,
             hostEffecterInfo[effecterInfoIndex]
@@ -277,20 +332,7 @@ void HostEffecterParser::processHostEffecterChangeNotification(
             stateField.push_back({PLDM_NO_CHANGE, 0});
         }
     }
-    int rc{};
-    try
-    {
-        rc = setHostStateEffecter(effecterInfoIndex, stateField, effecterId);
-    }
-    catch (const std::runtime_error& e)
-    {
-        error("Could not set host state effecter");
-        return;
-    }
-    if (rc != PLDM_SUCCESS)
-    {
-        error("Could not set the host state effecter, rc= {RC}", "RC", rc);
-    }
+    writeStateEffecter(effecterInfoIndex, stateField, effecterId);
 }
 
 double HostEffecterParser::adjustValue(double value, double offset,
@@ -348,23 +390,8 @@ void HostEffecterParser::processTerminusNumericEffecterChangeNotification(
         return;
     }
 
-    int rc{};
-    try
-    {
-        rc = setTerminusNumericEffecter(effecterInfoIndex, effecterId,
-                                        propValues.dataSize, rawValue);
-    }
-    catch (const std::runtime_error& e)
-    {
-        std::cerr << "Could not set numeric effecter ID=" << effecterId
-                  << std::endl;
-        return;
-    }
-    if (rc != PLDM_SUCCESS)
-    {
-        std::cerr << "Could not set the numeric effecter, ID=" << effecterId
-                  << " rc= " << rc << std::endl;
-    }
+    writeNumericEffecter(effecterInfoIndex, effecterId, propValues.dataSize,
+                         rawValue);
 
     hostEffecterInfo[effecterInfoIndex]
         .dbusNumericEffecterInfo[dbusInfoIndex]
@@ -472,9 +499,10 @@ int HostEffecterParser::setTerminusNumericEffecter(size_t effecterInfoIndex,
         return rc;
     }
 
-    auto setNumericEffecterRespHandler = [](mctp_eid_t /*eid*/,
-                                            const pldm_msg* response,
-                                            size_t respMsgLen) {
+    auto setNumericEffecterRespHandler =
+        [this, effecterInfoIndex, effecterId](
+            mctp_eid_t /*eid*/, const pldm_msg* response, size_t respMsgLen) {
+        effecterWriteDone(effecterInfoIndex, effecterId);
         if (response == nullptr || !respMsgLen)
         {
             std::cerr << "Failed to receive response for "
@@ -533,7 +561,9 @@ int HostEffecterParser::setHostStateEffecter(
     }
 
     auto setStateEffecterStatesRespHandler =
-        [](mctp_eid_t /*eid*/, const pldm_msg* response, size_t respMsgLen) {
+        [this, effecterInfoIndex, effecterId](
+            mctp_eid_t /*eid*/, const pldm_msg* response, size_t respMsgLen) {
+        effecterWriteDone(effecterInfoIndex, effecterId);
         if (response == nullptr || !respMsgLen)
         {
             error(
@@ -569,6 +599,104 @@ int HostEffecterParser::setHostStateEffecter(
     return rc;
 }
 
+void HostEffecterParser::writeStateEffecter(
+    size_t effecterInfoIndex,
+    const std::vector<set_effecter_state_field>& stateField,
+    uint16_t effecterId)
+{
+    auto& write = effecterWrites[{effecterInfoIndex, effecterId}];
+    if (write.pending && write.stateField.size() == stateField.size())
+    {
+        /* Merge with the states held, the latest one of each field wins */
+        for (size_t i = 0; i < stateField.size(); i++)
+        {
+            if (stateField[i].set_request == PLDM_REQUEST_SET)
+            {
+                write.stateField[i] = stateField[i];
+            }
+        }
+    }
+    else
+    {
+        write.stateField = stateField;
+    }
+    write.pending = true;
+
+    if (!write.inFlight)
+    {
+        sendEffecterWrite(effecterInfoIndex, effecterId);
+    }
+}
+
+void HostEffecterParser::writeNumericEffecter(size_t effecterInfoIndex,
+                                              uint16_t effecterId,
+                                              uint8_t dataSize,
+                                              double rawValue)
+{
+    auto& write = effecterWrites[{effecterInfoIndex, effecterId}];
+    write.dataSize = dataSize;
+    write.rawValue = rawValue;
+    write.pending = true;
+
+    if (!write.inFlight)
+    {
+        sendEffecterWrite(effecterInfoIndex, effecterId);
+    }
+}
+
+void HostEffecterParser::sendEffecterWrite(size_t effecterInfoIndex,
+                                           uint16_t effecterId)
+{
+    auto& write = effecterWrites[{effecterInfoIndex, effecterId}];
+    write.pending = false;
+    write.inFlight = true;
+
+    int rc{};
+    try
+    {
+        if (hostEffecterInfo[effecterInfoIndex].effecterPdrType ==
+            PLDM_NUMERIC_EFFECTER_PDR)
+        {
+            rc = setTerminusNumericEffecter(effecterInfoIndex, effecterId,
+                                            write.dataSize, write.rawValue);
+        }
+        else
+        {
+            auto stateField = std::move(write.stateField);
+            write.stateField.clear();
+            rc = setHostStateEffecter(effecterInfoIndex, stateField,
+                                      effecterId);
+        }
+    }
+    catch (const std::runtime_error& e)
+    {
+        error("Could not set host effecter, ID = {EFFECTER_ID}",
+              "EFFECTER_ID", effecterId);
+        rc = PLDM_ERROR;
+    }
+    if (rc != PLDM_SUCCESS)
+    {
+        error("Could not set the host effecter, ID = {EFFECTER_ID} rc = {RC}",
+              "EFFECTER_ID", effecterId, "RC", rc);
+        write.inFlight = false;
+    }
+}
+
+void HostEffecterParser::effecterWriteDone(size_t effecterInfoIndex,
+                                           uint16_t effecterId)
+{
+    auto it = effecterWrites.find({effecterInfoIndex, effecterId});
+    if (it == effecterWrites.end())
+    {
+        return;
+    }
+    it->second.inFlight = false;
+    if (it->second.pending)
+    {
+        sendEffecterWrite(effecterInfoIndex, effecterId);
+    }
+}
+
 void HostEffecterParser::createHostEffecterMatch(const std::string& objectPath,
                                                  const std::string& interface,
                                                  size_t effecterInfoIndex,
@@ -7,6 +7,8 @@
 
 #include <phosphor-logging/lg2.hpp>
 
+#include <map>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -74,6 +76,21 @@ struct EffecterInfo
         dbusNumericEffecterInfo; //!< D-Bus information for the effecter id
 };
 
+/** @struct EffecterWrite
+ *  Contains the set request state of an effecter. A value changing while a
+ *  set request is outstanding is held as pending, the last value winning, and
+ *  sent once the outstanding request completes.
+ */
+struct EffecterWrite
+{
+    bool inFlight = false; //!< Set request awaiting its response
+    bool pending = false;  //!< Value waiting for the outstanding request
+    std::vector<set_effecter_state_field>
+        stateField;        //!< Pending states of a state effecter
+    uint8_t dataSize = 0;  //!< Pending numeric effecter data size
+    double rawValue = 0;   //!< Pending numeric effecter raw value
+};
+
 /** @class HostEffecterParser
  *
  *  @brief This class parses the Host Effecter json file and monitors for the
@@ -104,7 +121,8 @@ class HostEffecterParser
         const std::string& jsonPath,
         pldm::requester::Handler<pldm::requester::Request>* handler) :
         instanceIdDb(instanceIdDb),
-        sockFd(fd), pdrRepo(repo), dbusHandler(dbusHandler), handler(handler)
+        sockFd(fd), pdrRepo(repo), pdrIndex(repo), dbusHandler(dbusHandler),
+        handler(handler)
     {
         try
         {
@@ -216,6 +234,41 @@ class HostEffecterParser
                                          size_t dbusInfoIndex,
                                          uint16_t effecterId);
 
+    /* @brief Set the states of a host state effecter, or hold them until the
+     *        outstanding set request of the effecter completes
+     *
+     * @param[in] effecterInfoIndex - index of effecterInfo pointer in
+     *                                hostEffecterInfo
+     * @param[in] stateField - vector of state fields equal to composite
+     *                         effecter count in number
+     * @param[in] effecterId - host effecter id
+     */
+    void writeStateEffecter(
+        size_t effecterInfoIndex,
+        const std::vector<set_effecter_state_field>& stateField,
+        uint16_t effecterId);
+
+    /* @brief Set the value of a terminus numeric effecter, or hold it until
+     *        the outstanding set request of the effecter completes
+     *
+     * @param[in] effecterInfoIndex - index of effecterInfo pointer in
+     *                                hostEffecterInfo
+     * @param[in] effecterId - host effecter id
+     * @param[in] dataSize - data size
+     * @param[in] rawValue - raw value
+     */
+    void writeNumericEffecter(size_t effecterInfoIndex, uint16_t effecterId,
+                              uint8_t dataSize, double rawValue);
+
+    /* @brief Record the completion of the set request of an effecter and
+     *        send the value held meanwhile, if any
+     *
+     * @param[in] effecterInfoIndex - index of effecterInfo pointer in
+     *                                hostEffecterInfo
+     * @param[in] effecterId - host effecter id
+     */
+    void effecterWriteDone(size_t effecterInfoIndex, uint16_t effecterId);
+
   private:
     /* @brief Adjust the nummeric effecter value base on the effecter
      *        configurations
@@ -230,16 +283,32 @@ class HostEffecterParser
     double adjustValue(double value, double offset, double resolution,
                        int8_t modify);
     /* @brief Verify host On state before configure the host effecters
+     *
+     *  The state is read once and then kept up to date from the BootProgress
+     *  property changes.
      *
      * @return - true if host is on and false for others cases
      */
     bool isHostOn(void);
 
+    /* @brief Subscribe to the BootProgress property changes of the host
+     */
+    void createHostStateMatch();
+
+    /* @brief Send the value held for an effecter
+     *
+     * @param[in] effecterInfoIndex - index of effecterInfo pointer in
+     *                                hostEffecterInfo
+     * @param[in] effecterId - host effecter id
+     */
+    void sendEffecterWrite(size_t effecterInfoIndex, uint16_t effecterId);
+
   protected:
     pldm::InstanceIdDb* instanceIdDb; //!< Reference to the InstanceIdDb object
                                       //!< to obtain instance id
     int sockFd;                       //!< Socket fd to send message to host
     const pldm_pdr* pdrRepo;          //!< Reference to PDR repo
+    pldm::utils::PDRIndex pdrIndex;   //!< Effecter id lookups in the PDR repo
     std::vector<EffecterInfo> hostEffecterInfo; //!< Parsed effecter information
     std::vector<std::unique_ptr<sdbusplus::bus::match_t>>
         effecterInfoMatch; //!< vector to catch the D-Bus property change
@@ -247,6 +316,12 @@ class HostEffecterParser
     const pldm::utils::DBusHandler* dbusHandler; //!< D-bus Handler
     /** @brief PLDM request handler */
     pldm::requester::Handler<pldm::requester::Request>* handler;
+    /** @brief Set request state by effecter info index and effecter id */
+    std::map<std::pair<size_t, uint16_t>, EffecterWrite> effecterWrites;
+    /** @brief Host state, empty until read */
+    std::optional<bool> hostOn;
+    /** @brief D-Bus match for the host BootProgress changes */
+    std::unique_ptr<sdbusplus::bus::match_t> hostStateMatch;
 };
 
 } // namespace host_effecters
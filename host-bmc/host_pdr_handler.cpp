@@ -153,6 +153,7 @@ HostPDRHandler::HostPDRHandler(
                     return key != TERMINUS_HANDLE;
                 });
                 pldm_pdr_remove_remote_pdrs(repo);
+                pdrRepoChanged(repo);
                 pldm_entity_association_tree_destroy_root(entityTree);
                 pldm_entity_association_tree_copy_root(bmcEntityTree,
                                                        entityTree);
@@ -264,6 +265,7 @@ void HostPDRHandler::mergeEntityAssociations(
         // Adding the remote range PDRs to the repo before merging it
         uint32_t handle = record_handle;
         pldm_pdr_add_check(repo, pdr.data(), size, true, 0xFFFF, &handle);
+        pdrRepoChanged(repo);
     }
 
     pldm_entity_association_pdr_extract(pdr.data(), pdr.size(), &numEntities,
@@ -344,6 +346,7 @@ void HostPDRHandler::mergeEntityAssociations(
                 rc = pldm_entity_association_pdr_add_from_node_check(
                     node, repo, &entities, numEntities, true, TERMINUS_HANDLE);
             }
+            pdrRepoChanged(repo);
 
             if (rc)
             {
@@ -643,6 +646,7 @@ void HostPDRHandler::processHostPDRs(mctp_eid_t /*eid*/,
                         // pldm_pdr_add() assert()ed on failure to add a PDR.
                         throw std::runtime_error("Failed to add PDR");
                     }
+                    pdrRepoChanged(repo);
                 }
             }
         }
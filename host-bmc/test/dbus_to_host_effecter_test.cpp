@@ -8,6 +8,8 @@
 
 using namespace pldm::host_effecters;
 using namespace pldm::utils;
+using ::testing::_;
+using ::testing::Return;
 
 class MockHostEffecterParser : public HostEffecterParser
 {
@@ -22,6 +24,9 @@ class MockHostEffecterParser : public HostEffecterParser
                 (size_t, std::vector<set_effecter_state_field>&, uint16_t),
                 (override));
 
+    MOCK_METHOD(int, setTerminusNumericEffecter,
+                (size_t, uint16_t, uint8_t, double), (override));
+
     MOCK_METHOD(void, createHostEffecterMatch,
                 (const std::string&, const std::string&, size_t, size_t,
                  uint16_t),
@@ -87,3 +92,52 @@ TEST(HostEffecterParser, findNewStateValue)
     ASSERT_THROW(hostEffecterParser.findNewStateValue(0, 0, val2),
                  std::exception);
 }
+
+TEST(HostEffecterParser, coalesceEffecterWrites)
+{
+    MockdBusHandler dbusHandler;
+    int sockfd{};
+    MockHostEffecterParser hostEffecterParser(sockfd, nullptr, &dbusHandler,
+                                              "./host_effecter_jsons/good");
+
+    std::vector<uint8_t> sent;
+    EXPECT_CALL(hostEffecterParser, setHostStateEffecter(0, _, 4))
+        .WillRepeatedly([&sent](size_t,
+                                std::vector<set_effecter_state_field>& field,
+                                uint16_t) {
+        sent.push_back(field[0].effecter_state);
+        return PLDM_SUCCESS;
+    });
+
+    /* The first state is sent, the last one waits for its response */
+    for (uint8_t state = 1; state <= 5; state++)
+    {
+        hostEffecterParser.writeStateEffecter(0, {{PLDM_REQUEST_SET, state}},
+                                              4);
+    }
+    EXPECT_EQ(sent, std::vector<uint8_t>{1});
+    hostEffecterParser.effecterWriteDone(0, 4);
+    EXPECT_EQ(sent, (std::vector<uint8_t>{1, 5}));
+    hostEffecterParser.effecterWriteDone(0, 4);
+    EXPECT_EQ(sent.size(), 2);
+
+    /* Nothing outstanding, the state is sent right away */
+    hostEffecterParser.writeStateEffecter(0, {{PLDM_REQUEST_SET, 6}}, 4);
+    EXPECT_EQ(sent, (std::vector<uint8_t>{1, 5, 6}));
+}
+
+TEST(HostEffecterParser, failedEffecterWrite)
+{
+    MockdBusHandler dbusHandler;
+    int sockfd{};
+    MockHostEffecterParser hostEffecterParser(sockfd, nullptr, &dbusHandler,
+                                              "./host_effecter_jsons/good");
+
+    EXPECT_CALL(hostEffecterParser, setHostStateEffecter(0, _, 4))
+        .WillOnce(Return(PLDM_ERROR))
+        .WillOnce(Return(PLDM_SUCCESS));
+
+    /* A request not sent does not hold back the next state */
+    hostEffecterParser.writeStateEffecter(0, {{PLDM_REQUEST_SET, 1}}, 4);
+    hostEffecterParser.writeStateEffecter(0, {{PLDM_REQUEST_SET, 2}}, 4);
+}
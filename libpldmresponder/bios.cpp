@@ -73,7 +73,8 @@ Handler::Handler(
     pldm::requester::Handler<pldm::requester::Request>* handler,
     pldm::responder::platform_config::Handler* platformConfigHandler) :
     biosConfig(BIOS_JSONS_DIR, BIOS_TABLES_DIR, &dbusHandler, fd, eid,
-               instanceIdDb, handler, platformConfigHandler)
+               instanceIdDb, handler, platformConfigHandler),
+    tableTransfer(BIOS_TABLE_MAX_TRANSFER_SIZE)
 {
     biosConfig.removeTables();
     biosConfig.buildTables();
@@ -240,20 +241,31 @@ Response Handler::getBIOSTable(const pldm_msg* request, size_t payloadLength)
         return ccOnlyResponse(request, rc);
     }
 
-    auto table =
-        biosConfig.getBIOSTable(static_cast<pldm_bios_table_types>(tableType));
+    auto table = biosConfig.getBIOSTable(tableType);
     if (!table)
     {
         return ccOnlyResponse(request, PLDM_BIOS_TABLE_UNAVAILABLE);
     }
 
+    BIOSTableTransfer::Part part{};
+    rc = tableTransfer.getPart(tableType,
+                               biosConfig.getBIOSTableGeneration(tableType),
+                               table->size(), transferHandle, transferOpFlag,
+                               part);
+    if (rc != PLDM_SUCCESS)
+    {
+        return ccOnlyResponse(request, rc);
+    }
+
     Response response(sizeof(pldm_msg_hdr) +
-                      PLDM_GET_BIOS_TABLE_MIN_RESP_BYTES + table->size());
+                      PLDM_GET_BIOS_TABLE_MIN_RESP_BYTES + part.length);
     auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
 
+    // The part is copied straight from the cached table into the response
     rc = encode_get_bios_table_resp(
-        request->hdr.instance_id, PLDM_SUCCESS, 0 /* nxtTransferHandle */,
-        PLDM_START_AND_END, table->data(), response.size(), responsePtr);
+        request->hdr.instance_id, PLDM_SUCCESS, part.nextTransferHandle,
+        part.transferFlag, const_cast<uint8_t*>(table->data() + part.offset),
+        response.size(), responsePtr);
     if (rc != PLDM_SUCCESS)
     {
         return ccOnlyResponse(request, rc);
@@ -91,6 +91,9 @@ class Handler : public CmdHandler
 
   private:
     BIOSConfig biosConfig;
+
+    /** @brief Multipart GetBIOSTable transfers */
+    BIOSTableTransfer tableTransfer;
 };
 
 } // namespace bios
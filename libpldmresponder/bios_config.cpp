@@ -48,7 +48,8 @@ BIOSConfig::BIOSConfig(
     jsonDir(jsonDir),
     tableDir(tableDir), dbusHandler(dbusHandler), fd(fd), eid(eid),
     instanceIdDb(instanceIdDb), handler(handler),
-    platformConfigHandler(platformConfigHandler)
+    platformConfigHandler(platformConfigHandler),
+    persistTimer([this]() { flushTables(); })
 
 {
     if (platformConfigHandler)
@@ -60,10 +61,25 @@ BIOSConfig::BIOSConfig(
         }
     }
     fs::create_directories(tableDir);
+    for (uint8_t type = 0; type < numTables; type++)
+    {
+        auto table =
+            loadTable(tablePath(static_cast<pldm_bios_table_types>(type)));
+        if (table)
+        {
+            tables[type] = std::move(*table);
+            indexTable(static_cast<pldm_bios_table_types>(type));
+        }
+    }
     constructAttributes();
     listenPendingAttributes();
 }
 
+BIOSConfig::~BIOSConfig()
+{
+    syncTables();
+}
+
 void BIOSConfig::buildTables()
 {
     auto stringTable = buildAndStoreStringTable();
@@ -73,31 +89,23 @@ void BIOSConfig::buildTables()
     }
 }
 
-std::optional<Table> BIOSConfig::getBIOSTable(pldm_bios_table_types tableType)
+const Table* BIOSConfig::getBIOSTable(uint8_t tableType) const
 {
-    fs::path tablePath;
-    switch (tableType)
+    if (tableType >= numTables || tables[tableType].empty())
     {
-        case PLDM_BIOS_STRING_TABLE:
-            tablePath = tableDir / stringTableFile;
-            break;
-        case PLDM_BIOS_ATTR_TABLE:
-            tablePath = tableDir / attrTableFile;
-            break;
-        case PLDM_BIOS_ATTR_VAL_TABLE:
-            tablePath = tableDir / attrValueTableFile;
-            break;
+        return nullptr;
     }
-    return loadTable(tablePath);
+    return &tables[tableType];
+}
+
+uint32_t BIOSConfig::getBIOSTableGeneration(uint8_t tableType) const
+{
+    return tableType < numTables ? tableGenerations[tableType] : 0;
 }
 
 int BIOSConfig::setBIOSTable(uint8_t tableType, const Table& table,
                              bool updateBaseBIOSTable)
 {
-    fs::path stringTablePath(tableDir / stringTableFile);
-    fs::path attrTablePath(tableDir / attrTableFile);
-    fs::path attrValueTablePath(tableDir / attrValueTableFile);
-
     if (!pldm_bios_table_checksum(table.data(), table.size()))
     {
         return PLDM_INVALID_BIOS_TABLE_DATA_INTEGRITY_CHECK;
@@ -105,12 +113,11 @@ int BIOSConfig::setBIOSTable(uint8_t tableType, const Table& table,
 
     if (tableType == PLDM_BIOS_STRING_TABLE)
     {
-        storeTable(stringTablePath, table);
+        cacheTable(PLDM_BIOS_STRING_TABLE, Table(table));
     }
     else if (tableType == PLDM_BIOS_ATTR_TABLE)
     {
-        BIOSTable biosStringTable(stringTablePath.c_str());
-        if (biosStringTable.isEmpty())
+        if (tables[PLDM_BIOS_STRING_TABLE].empty())
         {
             return PLDM_INVALID_BIOS_TABLE_TYPE;
         }
@@ -121,13 +128,12 @@ int BIOSConfig::setBIOSTable(uint8_t tableType, const Table& table,
             return rc;
         }
 
-        storeTable(attrTablePath, table);
+        cacheTable(PLDM_BIOS_ATTR_TABLE, Table(table));
     }
     else if (tableType == PLDM_BIOS_ATTR_VAL_TABLE)
     {
-        BIOSTable biosStringTable(stringTablePath.c_str());
-        BIOSTable biosStringValueTable(attrTablePath.c_str());
-        if (biosStringTable.isEmpty() || biosStringValueTable.isEmpty())
+        if (tables[PLDM_BIOS_STRING_TABLE].empty() ||
+            tables[PLDM_BIOS_ATTR_TABLE].empty())
         {
             return PLDM_INVALID_BIOS_TABLE_TYPE;
         }
@@ -138,7 +144,7 @@ int BIOSConfig::setBIOSTable(uint8_t tableType, const Table& table,
             return rc;
         }
 
-        storeTable(attrValueTablePath, table);
+        cacheTable(PLDM_BIOS_ATTR_VAL_TABLE, Table(table));
     }
     else
     {
@@ -156,15 +162,13 @@ int BIOSConfig::setBIOSTable(uint8_t tableType, const Table& table,
 int BIOSConfig::checkAttributeTable(const Table& table)
 {
     using namespace pldm::bios::utils;
-    auto stringTable = getBIOSTable(PLDM_BIOS_STRING_TABLE);
     for (auto entry :
          BIOSTableIter<PLDM_BIOS_ATTR_TABLE>(table.data(), table.size()))
     {
         auto attrNameHandle =
             pldm_bios_table_attr_entry_decode_string_handle(entry);
 
-        auto stringEnty = pldm_bios_table_string_find_by_handle(
-            stringTable->data(), stringTable->size(), attrNameHandle);
+        auto stringEnty = stringLookup->findEntry(attrNameHandle);
         if (stringEnty == nullptr)
         {
             return PLDM_INVALID_BIOS_ATTR_HANDLE;
@@ -195,8 +199,7 @@ int BIOSConfig::checkAttributeTable(const Table& table)
 
                 for (size_t i = 0; i < pvHandls.size(); i++)
                 {
-                    auto stringEntry = pldm_bios_table_string_find_by_handle(
-                        stringTable->data(), stringTable->size(), pvHandls[i]);
+                    auto stringEntry = stringLookup->findEntry(pvHandls[i]);
                     if (stringEntry == nullptr)
                     {
                         return PLDM_INVALID_BIOS_ATTR_HANDLE;
@@ -205,9 +208,8 @@ int BIOSConfig::checkAttributeTable(const Table& table)
 
                 for (size_t i = 0; i < defIndices.size(); i++)
                 {
-                    auto stringEntry = pldm_bios_table_string_find_by_handle(
-                        stringTable->data(), stringTable->size(),
-                        pvHandls[defIndices[i]]);
+                    auto stringEntry =
+                        stringLookup->findEntry(pvHandls[defIndices[i]]);
                     if (stringEntry == nullptr)
                     {
                         return PLDM_INVALID_BIOS_ATTR_HANDLE;
@@ -233,230 +235,235 @@ int BIOSConfig::checkAttributeTable(const Table& table)
 int BIOSConfig::checkAttributeValueTable(const Table& table)
 {
     using namespace pldm::bios::utils;
-    auto stringTable = getBIOSTable(PLDM_BIOS_STRING_TABLE);
-    auto attrTable = getBIOSTable(PLDM_BIOS_ATTR_TABLE);
 
     baseBIOSTableMaps.clear();
 
     for (auto tableEntry :
          BIOSTableIter<PLDM_BIOS_ATTR_VAL_TABLE>(table.data(), table.size()))
     {
-        AttributeName attributeName{};
-        AttributeType attributeType{};
-        ReadonlyStatus readonlyStatus{};
-        DisplayName displayName{};
-        Description description{};
-        MenuPath menuPath{};
-        CurrentValue currentValue{};
-        DefaultValue defaultValue{};
-        std::vector<ValueDisplayName> valueDisplayNames;
-        std::map<uint16_t, std::vector<std::string>> valueDisplayNamesMap;
-        Option options{};
-
-        auto attrValueHandle =
-            pldm_bios_table_attr_value_entry_decode_attribute_handle(
-                tableEntry);
-        auto attrType = static_cast<pldm_bios_attribute_type>(
-            pldm_bios_table_attr_value_entry_decode_attribute_type(tableEntry));
-
-        auto attrEntry = pldm_bios_table_attr_find_by_handle(
-            attrTable->data(), attrTable->size(), attrValueHandle);
-        if (attrEntry == nullptr)
-        {
-            return PLDM_INVALID_BIOS_ATTR_HANDLE;
-        }
-        auto attrHandle =
-            pldm_bios_table_attr_entry_decode_attribute_handle(attrEntry);
-        auto attrNameHandle =
-            pldm_bios_table_attr_entry_decode_string_handle(attrEntry);
-
-        auto stringEntry = pldm_bios_table_string_find_by_handle(
-            stringTable->data(), stringTable->size(), attrNameHandle);
-        if (stringEntry == nullptr)
+        auto rc = checkAttributeValueEntry(tableEntry);
+        if (rc != PLDM_SUCCESS)
         {
-            return PLDM_INVALID_BIOS_ATTR_HANDLE;
+            return rc;
         }
-        auto strLength =
-            pldm_bios_table_string_entry_decode_string_length(stringEntry);
-        std::vector<char> buffer(strLength + 1 /* sizeof '\0' */);
-        // Preconditions are upheld therefore no error check necessary
-        pldm_bios_table_string_entry_decode_string_check(
-            stringEntry, buffer.data(), buffer.size());
-
-        attributeName = std::string(buffer.data(), buffer.data() + strLength);
+    }
 
-        if (!biosAttributes.empty())
-        {
-            readonlyStatus =
-                biosAttributes[attrHandle % biosAttributes.size()]->readOnly;
-            description =
-                biosAttributes[attrHandle % biosAttributes.size()]->helpText;
-            displayName =
-                biosAttributes[attrHandle % biosAttributes.size()]->displayName;
-            valueDisplayNamesMap =
-                biosAttributes[attrHandle % biosAttributes.size()]
-                    ->valueDisplayNamesMap;
-        }
+    return PLDM_SUCCESS;
+}
 
-        switch (attrType)
-        {
-            case PLDM_BIOS_ENUMERATION:
-            case PLDM_BIOS_ENUMERATION_READ_ONLY:
-            {
-                if (valueDisplayNamesMap.contains(attrHandle))
-                {
-                    const std::vector<ValueDisplayName>& vdn =
-                        valueDisplayNamesMap[attrHandle];
-                    valueDisplayNames.insert(valueDisplayNames.end(),
-                                             vdn.begin(), vdn.end());
-                }
-                auto getValue = [](uint16_t handle,
-                                   const Table& table) -> std::string {
-                    auto stringEntry = pldm_bios_table_string_find_by_handle(
-                        table.data(), table.size(), handle);
-
-                    auto strLength =
-                        pldm_bios_table_string_entry_decode_string_length(
-                            stringEntry);
-                    std::vector<char> buffer(strLength + 1 /* sizeof '\0' */);
-                    // Preconditions are upheld therefore no error check
-                    // necessary
-                    pldm_bios_table_string_entry_decode_string_check(
-                        stringEntry, buffer.data(), buffer.size());
-
-                    return std::string(buffer.data(),
-                                       buffer.data() + strLength);
-                };
-
-                attributeType = "xyz.openbmc_project.BIOSConfig.Manager."
-                                "AttributeType.Enumeration";
+int BIOSConfig::checkAttributeValueEntry(
+    const pldm_bios_attr_val_table_entry* tableEntry)
+{
+    const auto& attrTable = tables[PLDM_BIOS_ATTR_TABLE];
+    AttributeName attributeName{};
+    AttributeType attributeType{};
+    ReadonlyStatus readonlyStatus{};
+    DisplayName displayName{};
+    Description description{};
+    MenuPath menuPath{};
+    CurrentValue currentValue{};
+    DefaultValue defaultValue{};
+    std::vector<ValueDisplayName> valueDisplayNames;
+    std::map<uint16_t, std::vector<std::string>> valueDisplayNamesMap;
+    Option options{};
+
+    auto attrValueHandle =
+        pldm_bios_table_attr_value_entry_decode_attribute_handle(tableEntry);
+    auto attrType = static_cast<pldm_bios_attribute_type>(
+        pldm_bios_table_attr_value_entry_decode_attribute_type(tableEntry));
+
+    auto attrEntry = attrLookup->findByHandle(attrTable, attrValueHandle);
+    if (attrEntry == nullptr)
+    {
+        return PLDM_INVALID_BIOS_ATTR_HANDLE;
+    }
+    auto attrHandle =
+        pldm_bios_table_attr_entry_decode_attribute_handle(attrEntry);
+    auto attrNameHandle =
+        pldm_bios_table_attr_entry_decode_string_handle(attrEntry);
 
-                uint8_t pvNum;
-                // Preconditions are upheld therefore no error check necessary
-                pldm_bios_table_attr_entry_enum_decode_pv_num_check(attrEntry,
-                                                                    &pvNum);
-                std::vector<uint16_t> pvHandls(pvNum);
-                // Preconditions are upheld therefore no error check necessary
-                pldm_bios_table_attr_entry_enum_decode_pv_hdls_check(
-                    attrEntry, pvHandls.data(), pvHandls.size());
+    auto stringEntry = stringLookup->findEntry(attrNameHandle);
+    if (stringEntry == nullptr)
+    {
+        return PLDM_INVALID_BIOS_ATTR_HANDLE;
+    }
+    auto strLength =
+        pldm_bios_table_string_entry_decode_string_length(stringEntry);
+    std::vector<char> buffer(strLength + 1 /* sizeof '\0' */);
+    // Preconditions are upheld therefore no error check necessary
+    pldm_bios_table_string_entry_decode_string_check(
+        stringEntry, buffer.data(), buffer.size());
 
-                // get possible_value
-                for (size_t i = 0; i < pvHandls.size(); i++)
-                {
-                    options.push_back(
-                        std::make_tuple("xyz.openbmc_project.BIOSConfig."
-                                        "Manager.BoundType.OneOf",
-                                        getValue(pvHandls[i], *stringTable),
-                                        valueDisplayNames[i]));
-                }
+    attributeName = std::string(buffer.data(), buffer.data() + strLength);
 
-                auto count =
-                    pldm_bios_table_attr_value_entry_enum_decode_number(
-                        tableEntry);
-                std::vector<uint8_t> handles(count);
-                pldm_bios_table_attr_value_entry_enum_decode_handles(
-                    tableEntry, handles.data(), handles.size());
+    if (!biosAttributes.empty())
+    {
+        readonlyStatus =
+            biosAttributes[attrHandle % biosAttributes.size()]->readOnly;
+        description =
+            biosAttributes[attrHandle % biosAttributes.size()]->helpText;
+        displayName =
+            biosAttributes[attrHandle % biosAttributes.size()]->displayName;
+        valueDisplayNamesMap =
+            biosAttributes[attrHandle % biosAttributes.size()]
+                ->valueDisplayNamesMap;
+    }
 
-                // get current_value
-                for (size_t i = 0; i < handles.size(); i++)
+    switch (attrType)
+    {
+        case PLDM_BIOS_ENUMERATION:
+        case PLDM_BIOS_ENUMERATION_READ_ONLY:
+        {
+            if (valueDisplayNamesMap.contains(attrHandle))
+            {
+                const std::vector<ValueDisplayName>& vdn =
+                    valueDisplayNamesMap[attrHandle];
+                valueDisplayNames.insert(valueDisplayNames.end(),
+                                         vdn.begin(), vdn.end());
+            }
+            auto getValue = [this](uint16_t handle) -> std::string {
+                auto stringEntry = stringLookup->findEntry(handle);
+                if (stringEntry == nullptr)
                 {
-                    currentValue = getValue(pvHandls[handles[i]], *stringTable);
+                    return {};
                 }
 
-                uint8_t defNum;
+                auto strLength =
+                    pldm_bios_table_string_entry_decode_string_length(
+                        stringEntry);
+                std::vector<char> buffer(strLength + 1 /* sizeof '\0' */);
                 // Preconditions are upheld therefore no error check necessary
-                pldm_bios_table_attr_entry_enum_decode_def_num_check(attrEntry,
-                                                                     &defNum);
-                std::vector<uint8_t> defIndices(defNum);
-                pldm_bios_table_attr_entry_enum_decode_def_indices(
-                    attrEntry, defIndices.data(), defIndices.size());
-
-                // get default_value
-                for (size_t i = 0; i < defIndices.size(); i++)
-                {
-                    defaultValue = getValue(pvHandls[defIndices[i]],
-                                            *stringTable);
-                }
-
-                break;
-            }
-            case PLDM_BIOS_INTEGER:
-            case PLDM_BIOS_INTEGER_READ_ONLY:
+                pldm_bios_table_string_entry_decode_string_check(
+                    stringEntry, buffer.data(), buffer.size());
+
+                return std::string(buffer.data(), buffer.data() + strLength);
+            };
+
+            attributeType = "xyz.openbmc_project.BIOSConfig.Manager."
+                            "AttributeType.Enumeration";
+
+            uint8_t pvNum;
+            // Preconditions are upheld therefore no error check necessary
+            pldm_bios_table_attr_entry_enum_decode_pv_num_check(attrEntry,
+                                                                &pvNum);
+            std::vector<uint16_t> pvHandls(pvNum);
+            // Preconditions are upheld therefore no error check necessary
+            pldm_bios_table_attr_entry_enum_decode_pv_hdls_check(
+                attrEntry, pvHandls.data(), pvHandls.size());
+
+            // get possible_value
+            for (size_t i = 0; i < pvHandls.size(); i++)
             {
-                attributeType = "xyz.openbmc_project.BIOSConfig.Manager."
-                                "AttributeType.Integer";
-                currentValue = static_cast<int64_t>(
-                    pldm_bios_table_attr_value_entry_integer_decode_cv(
-                        tableEntry));
-
-                uint64_t lower, upper, def;
-                uint32_t scalar;
-                pldm_bios_table_attr_entry_integer_decode(
-                    attrEntry, &lower, &upper, &scalar, &def);
-                options.push_back(std::make_tuple(
-                    "xyz.openbmc_project.BIOSConfig.Manager."
-                    "BoundType.LowerBound",
-                    static_cast<int64_t>(lower), attributeName));
-                options.push_back(std::make_tuple(
-                    "xyz.openbmc_project.BIOSConfig.Manager."
-                    "BoundType.UpperBound",
-                    static_cast<int64_t>(upper), attributeName));
-                options.push_back(std::make_tuple(
-                    "xyz.openbmc_project.BIOSConfig.Manager."
-                    "BoundType.ScalarIncrement",
-                    static_cast<int64_t>(scalar), attributeName));
-                defaultValue = static_cast<int64_t>(def);
-                break;
+                options.push_back(
+                    std::make_tuple("xyz.openbmc_project.BIOSConfig."
+                                    "Manager.BoundType.OneOf",
+                                    getValue(pvHandls[i]),
+                                    valueDisplayNames[i]));
             }
-            case PLDM_BIOS_STRING:
-            case PLDM_BIOS_STRING_READ_ONLY:
+
+            auto count = pldm_bios_table_attr_value_entry_enum_decode_number(
+                tableEntry);
+            std::vector<uint8_t> handles(count);
+            pldm_bios_table_attr_value_entry_enum_decode_handles(
+                tableEntry, handles.data(), handles.size());
+
+            // get current_value
+            for (size_t i = 0; i < handles.size(); i++)
             {
-                attributeType = "xyz.openbmc_project.BIOSConfig.Manager."
-                                "AttributeType.String";
-                variable_field currentString;
-                pldm_bios_table_attr_value_entry_string_decode_string(
-                    tableEntry, &currentString);
-                currentValue = std::string(
-                    reinterpret_cast<const char*>(currentString.ptr),
-                    currentString.length);
-                auto min = pldm_bios_table_attr_entry_string_decode_min_length(
-                    attrEntry);
-                auto max = pldm_bios_table_attr_entry_string_decode_max_length(
-                    attrEntry);
-                uint16_t def;
-                // Preconditions are upheld therefore no error check necessary
-                pldm_bios_table_attr_entry_string_decode_def_string_length_check(
-                    attrEntry, &def);
-                std::vector<char> defString(def + 1);
-                pldm_bios_table_attr_entry_string_decode_def_string(
-                    attrEntry, defString.data(), defString.size());
-                options.push_back(
-                    std::make_tuple("xyz.openbmc_project.BIOSConfig.Manager."
-                                    "BoundType.MinStringLength",
-                                    static_cast<int64_t>(min), attributeName));
-                options.push_back(
-                    std::make_tuple("xyz.openbmc_project.BIOSConfig.Manager."
-                                    "BoundType.MaxStringLength",
-                                    static_cast<int64_t>(max), attributeName));
-                defaultValue = defString.data();
-                break;
+                currentValue = getValue(pvHandls[handles[i]]);
             }
-            case PLDM_BIOS_PASSWORD:
-            case PLDM_BIOS_PASSWORD_READ_ONLY:
+
+            uint8_t defNum;
+            // Preconditions are upheld therefore no error check necessary
+            pldm_bios_table_attr_entry_enum_decode_def_num_check(attrEntry,
+                                                                 &defNum);
+            std::vector<uint8_t> defIndices(defNum);
+            pldm_bios_table_attr_entry_enum_decode_def_indices(
+                attrEntry, defIndices.data(), defIndices.size());
+
+            // get default_value
+            for (size_t i = 0; i < defIndices.size(); i++)
             {
-                attributeType = "xyz.openbmc_project.BIOSConfig.Manager."
-                                "AttributeType.Password";
-                break;
+                defaultValue = getValue(pvHandls[defIndices[i]]);
             }
-            default:
-                return PLDM_INVALID_BIOS_ATTR_HANDLE;
+
+            break;
+        }
+        case PLDM_BIOS_INTEGER:
+        case PLDM_BIOS_INTEGER_READ_ONLY:
+        {
+            attributeType = "xyz.openbmc_project.BIOSConfig.Manager."
+                            "AttributeType.Integer";
+            currentValue = static_cast<int64_t>(
+                pldm_bios_table_attr_value_entry_integer_decode_cv(tableEntry));
+
+            uint64_t lower, upper, def;
+            uint32_t scalar;
+            pldm_bios_table_attr_entry_integer_decode(
+                attrEntry, &lower, &upper, &scalar, &def);
+            options.push_back(std::make_tuple(
+                "xyz.openbmc_project.BIOSConfig.Manager."
+                "BoundType.LowerBound",
+                static_cast<int64_t>(lower), attributeName));
+            options.push_back(std::make_tuple(
+                "xyz.openbmc_project.BIOSConfig.Manager."
+                "BoundType.UpperBound",
+                static_cast<int64_t>(upper), attributeName));
+            options.push_back(std::make_tuple(
+                "xyz.openbmc_project.BIOSConfig.Manager."
+                "BoundType.ScalarIncrement",
+                static_cast<int64_t>(scalar), attributeName));
+            defaultValue = static_cast<int64_t>(def);
+            break;
+        }
+        case PLDM_BIOS_STRING:
+        case PLDM_BIOS_STRING_READ_ONLY:
+        {
+            attributeType = "xyz.openbmc_project.BIOSConfig.Manager."
+                            "AttributeType.String";
+            variable_field currentString;
+            pldm_bios_table_attr_value_entry_string_decode_string(
+                tableEntry, &currentString);
+            currentValue = std::string(
+                reinterpret_cast<const char*>(currentString.ptr),
+                currentString.length);
+            auto min = pldm_bios_table_attr_entry_string_decode_min_length(
+                attrEntry);
+            auto max = pldm_bios_table_attr_entry_string_decode_max_length(
+                attrEntry);
+            uint16_t def;
+            // Preconditions are upheld therefore no error check necessary
+            pldm_bios_table_attr_entry_string_decode_def_string_length_check(
+                attrEntry, &def);
+            std::vector<char> defString(def + 1);
+            pldm_bios_table_attr_entry_string_decode_def_string(
+                attrEntry, defString.data(), defString.size());
+            options.push_back(
+                std::make_tuple("xyz.openbmc_project.BIOSConfig.Manager."
+                                "BoundType.MinStringLength",
+                                static_cast<int64_t>(min), attributeName));
+            options.push_back(
+                std::make_tuple("xyz.openbmc_project.BIOSConfig.Manager."
+                                "BoundType.MaxStringLength",
+                                static_cast<int64_t>(max), attributeName));
+            defaultValue = defString.data();
+            break;
+        }
+        case PLDM_BIOS_PASSWORD:
+        case PLDM_BIOS_PASSWORD_READ_ONLY:
+        {
+            attributeType = "xyz.openbmc_project.BIOSConfig.Manager."
+                            "AttributeType.Password";
+            break;
         }
-        baseBIOSTableMaps.emplace(
-            std::move(attributeName),
-            std::make_tuple(attributeType, readonlyStatus, displayName,
-                            description, menuPath, currentValue, defaultValue,
-                            std::move(options)));
+        default:
+            return PLDM_INVALID_BIOS_ATTR_HANDLE;
     }
+    baseBIOSTableMaps.insert_or_assign(
+        std::move(attributeName),
+        std::make_tuple(attributeType, readonlyStatus, displayName,
+                        description, menuPath, currentValue, defaultValue,
+                        std::move(options)));
 
     return PLDM_SUCCESS;
 }
@@ -608,10 +615,75 @@ std::optional<Table> BIOSConfig::buildAndStoreStringTable()
     return table;
 }
 
-void BIOSConfig::storeTable(const fs::path& path, const Table& table)
+void BIOSConfig::cacheTable(pldm_bios_table_types tableType, Table&& table)
 {
-    BIOSTable biosTable(path.c_str());
-    biosTable.store(table);
+    tables[tableType] = std::move(table);
+    indexTable(tableType);
+    tableChanged(tableType);
+}
+
+void BIOSConfig::tableChanged(pldm_bios_table_types tableType)
+{
+    tableGenerations[tableType]++;
+    dirtyTables[tableType] = true;
+    if (!persistTimer.isRunning())
+    {
+        persistTimer.start(
+            std::chrono::milliseconds(BIOS_TABLE_PERSIST_DELAY));
+    }
+}
+
+void BIOSConfig::indexTable(pldm_bios_table_types tableType)
+{
+    switch (tableType)
+    {
+        case PLDM_BIOS_STRING_TABLE:
+            stringLookup.emplace(tables[tableType]);
+            break;
+        case PLDM_BIOS_ATTR_TABLE:
+            attrLookup.emplace(tables[tableType]);
+            break;
+        case PLDM_BIOS_ATTR_VAL_TABLE:
+            attrValueLookup.emplace(tables[tableType]);
+            break;
+        default:
+            break;
+    }
+}
+
+void BIOSConfig::flushTables()
+{
+    persistTimer.stop();
+    for (uint8_t type = 0; type < numTables; type++)
+    {
+        if (dirtyTables[type])
+        {
+            tableWriter.submit(
+                tablePath(static_cast<pldm_bios_table_types>(type)),
+                Table(tables[type]));
+            dirtyTables[type] = false;
+        }
+    }
+}
+
+void BIOSConfig::syncTables()
+{
+    flushTables();
+    tableWriter.wait();
+}
+
+fs::path BIOSConfig::tablePath(pldm_bios_table_types tableType) const
+{
+    switch (tableType)
+    {
+        case PLDM_BIOS_STRING_TABLE:
+            return tableDir / stringTableFile;
+        case PLDM_BIOS_ATTR_TABLE:
+            return tableDir / attrTableFile;
+        case PLDM_BIOS_ATTR_VAL_TABLE:
+        default:
+            return tableDir / attrValueTableFile;
+    }
 }
 
 std::optional<Table> BIOSConfig::loadTable(const fs::path& path)
@@ -672,13 +744,10 @@ std::string BIOSConfig::decodeStringFromStringEntry(
     return std::string(buffer.data(), buffer.data() + strLength);
 }
 
-std::string
-    BIOSConfig::displayStringHandle(uint16_t handle, uint8_t index,
-                                    const std::optional<Table>& attrTable,
-                                    const std::optional<Table>& stringTable)
+std::string BIOSConfig::displayStringHandle(uint16_t handle, uint8_t index)
 {
-    auto attrEntry = pldm_bios_table_attr_find_by_handle(
-        attrTable->data(), attrTable->size(), handle);
+    auto attrEntry = attrLookup->findByHandle(tables[PLDM_BIOS_ATTR_TABLE],
+                                              handle);
     uint8_t pvNum;
     int rc = pldm_bios_table_attr_entry_enum_decode_pv_num_check(attrEntry,
                                                                  &pvNum);
@@ -698,10 +767,7 @@ std::string
 
     std::string displayString = std::to_string(pvHandls[index]);
 
-    auto stringEntry = pldm_bios_table_string_find_by_handle(
-        stringTable->data(), stringTable->size(), pvHandls[index]);
-
-    auto decodedStr = decodeStringFromStringEntry(stringEntry);
+    auto decodedStr = stringLookup->findString(pvHandls[index]);
 
     return decodedStr + "(" + displayString + ")";
 }
@@ -710,15 +776,11 @@ void BIOSConfig::traceBIOSUpdate(
     const pldm_bios_attr_val_table_entry* attrValueEntry,
     const pldm_bios_attr_table_entry* attrEntry, bool isBMC)
 {
-    auto stringTable = getBIOSTable(PLDM_BIOS_STRING_TABLE);
-    auto attrTable = getBIOSTable(PLDM_BIOS_ATTR_TABLE);
-
     auto [attrHandle,
           attrType] = table::attribute_value::decodeHeader(attrValueEntry);
 
     auto attrHeader = table::attribute::decodeHeader(attrEntry);
-    BIOSStringTable biosStringTable(*stringTable);
-    auto attrName = biosStringTable.findString(attrHeader.stringHandle);
+    auto attrName = stringLookup->findString(attrHeader.stringHandle);
 
     switch (attrType)
     {
@@ -733,8 +795,7 @@ void BIOSConfig::traceBIOSUpdate(
 
             for (uint8_t handle : handles)
             {
-                auto nwVal = displayStringHandle(attrHandle, handle, attrTable,
-                                                 stringTable);
+                auto nwVal = displayStringHandle(attrHandle, handle);
                 auto chkBMC = isBMC ? "true" : "false";
                 info(
                     "BIOS:{ATTR_NAME}, updated to value: {NEW_VAL}, by BMC: {CHK_BMC} ",
@@ -771,7 +832,7 @@ void BIOSConfig::traceBIOSUpdate(
 
 int BIOSConfig::checkAttrValueToUpdate(
     const pldm_bios_attr_val_table_entry* attrValueEntry,
-    const pldm_bios_attr_table_entry* attrEntry, Table&)
+    const pldm_bios_attr_table_entry* attrEntry, const Table&)
 
 {
     auto [attrHandle,
@@ -853,8 +914,8 @@ int BIOSConfig::setAttrValue(const void* entry, size_t size, bool isBMC,
 
     auto attrValHeader = table::attribute_value::decodeHeader(attrValueEntry);
 
-    auto attrEntry = table::attribute::findByHandle(*attrTable,
-                                                    attrValHeader.attrHandle);
+    auto attrEntry = attrLookup->findByHandle(*attrTable,
+                                              attrValHeader.attrHandle);
     if (!attrEntry)
     {
         return PLDM_ERROR;
@@ -866,19 +927,24 @@ int BIOSConfig::setAttrValue(const void* entry, size_t size, bool isBMC,
         return rc;
     }
 
-    auto destTable = table::attribute_value::updateTable(*attrValueTable, entry,
-                                                         size);
-
-    if (!destTable)
+    auto oldEntry = attrValueLookup->findByHandle(*attrValueTable,
+                                                  attrValHeader.attrHandle);
+    std::optional<Table> destTable;
+    if (!oldEntry || pldm_bios_table_attr_value_entry_length(oldEntry) != size)
     {
-        return PLDM_ERROR;
+        destTable = table::attribute_value::updateTable(*attrValueTable, entry,
+                                                        size);
+        if (!destTable)
+        {
+            return PLDM_ERROR;
+        }
     }
 
     try
     {
         auto attrHeader = table::attribute::decodeHeader(attrEntry);
 
-        BIOSStringTable biosStringTable(*stringTable);
+        const auto& biosStringTable = *stringLookup;
         auto attrName = biosStringTable.findString(attrHeader.stringHandle);
         auto iter = std::find_if(
             biosAttributes.begin(), biosAttributes.end(),
@@ -900,7 +966,23 @@ int BIOSConfig::setAttrValue(const void* entry, size_t size, bool isBMC,
         return PLDM_ERROR;
     }
 
-    setBIOSTable(PLDM_BIOS_ATTR_VAL_TABLE, *destTable, updateBaseBIOSTable);
+    // Only the changed entry is checked and refreshed in baseBIOSTableMaps,
+    // an entry of the same length is replaced without copying the table
+    if (destTable)
+    {
+        cacheTable(PLDM_BIOS_ATTR_VAL_TABLE, std::move(*destTable));
+    }
+    else
+    {
+        table::attribute_value::replaceEntry(tables[PLDM_BIOS_ATTR_VAL_TABLE],
+                                             oldEntry, entry, size);
+        tableChanged(PLDM_BIOS_ATTR_VAL_TABLE);
+    }
+    rc = checkAttributeValueEntry(attrValueEntry);
+    if (rc == PLDM_SUCCESS && updateBaseBIOSTable)
+    {
+        updateBaseBIOSTableProperty();
+    }
 
     traceBIOSUpdate(attrValueEntry, attrEntry, isBMC);
 
@@ -909,6 +991,18 @@ int BIOSConfig::setAttrValue(const void* entry, size_t size, bool isBMC,
 
 void BIOSConfig::removeTables()
 {
+    persistTimer.stop();
+    /* A table still being written would be left behind the removal */
+    tableWriter.wait();
+    tables = {};
+    for (auto& generation : tableGenerations)
+    {
+        generation++;
+    }
+    dirtyTables = {};
+    stringLookup.reset();
+    attrLookup.reset();
+    attrValueLookup.reset();
     try
     {
         fs::remove(tableDir / stringTableFile);
@@ -936,16 +1030,15 @@ void BIOSConfig::processBiosAttrChangeNotification(
 
     PropertyValue newPropVal = it->second;
     auto stringTable = getBIOSTable(PLDM_BIOS_STRING_TABLE);
-    if (!stringTable.has_value())
+    if (!stringTable)
     {
         error("BIOS string table unavailable");
         return;
     }
-    BIOSStringTable biosStringTable(*stringTable);
     uint16_t attrNameHdl{};
     try
     {
-        attrNameHdl = biosStringTable.findHandle(attrName);
+        attrNameHdl = stringLookup->findHandle(attrName);
     }
     catch (const std::invalid_argument& e)
     {
@@ -955,13 +1048,13 @@ void BIOSConfig::processBiosAttrChangeNotification(
     }
 
     auto attrTable = getBIOSTable(PLDM_BIOS_ATTR_TABLE);
-    if (!attrTable.has_value())
+    if (!attrTable)
     {
         error("Attribute table not present");
         return;
     }
     const struct pldm_bios_attr_table_entry* tableEntry =
-        table::attribute::findByStringHandle(*attrTable, attrNameHdl);
+        attrLookup->findByStringHandle(*attrTable, attrNameHdl);
     if (tableEntry == nullptr)
     {
         error(
@@ -975,7 +1068,7 @@ void BIOSConfig::processBiosAttrChangeNotification(
 
     auto attrValueSrcTable = getBIOSTable(PLDM_BIOS_ATTR_VAL_TABLE);
 
-    if (!attrValueSrcTable.has_value())
+    if (!attrValueSrcTable)
     {
         error("Attribute value table not present");
         return;
@@ -991,13 +1084,6 @@ void BIOSConfig::processBiosAttrChangeNotification(
             "ATTR_HANDLE", attrHdl, "ATTR_TYPE", (uint32_t)attrType);
         return;
     }
-    auto destTable = table::attribute_value::updateTable(
-        *attrValueSrcTable, newValue.data(), newValue.size());
-    if (destTable.has_value())
-    {
-        storeTable(tableDir / attrValueTableFile, *destTable);
-    }
-
     rc = setAttrValue(newValue.data(), newValue.size(), true, false);
     if (rc != PLDM_SUCCESS)
     {
@@ -1008,25 +1094,20 @@ void BIOSConfig::processBiosAttrChangeNotification(
 
 uint16_t BIOSConfig::findAttrHandle(const std::string& attrName)
 {
-    auto stringTable = getBIOSTable(PLDM_BIOS_STRING_TABLE);
-    auto attrTable = getBIOSTable(PLDM_BIOS_ATTR_TABLE);
-
-    BIOSStringTable biosStringTable(*stringTable);
-    pldm::bios::utils::BIOSTableIter<PLDM_BIOS_ATTR_TABLE> attrTableIter(
-        attrTable->data(), attrTable->size());
-    auto stringHandle = biosStringTable.findHandle(attrName);
+    if (!stringLookup || !attrLookup)
+    {
+        throw std::invalid_argument("Unknow attribute Name");
+    }
 
-    for (auto entry : pldm::bios::utils::BIOSTableIter<PLDM_BIOS_ATTR_TABLE>(
-             attrTable->data(), attrTable->size()))
+    auto stringHandle = stringLookup->findHandle(attrName);
+    auto entry = attrLookup->findByStringHandle(tables[PLDM_BIOS_ATTR_TABLE],
+                                                stringHandle);
+    if (entry == nullptr)
     {
-        auto header = table::attribute::decodeHeader(entry);
-        if (header.stringHandle == stringHandle)
-        {
-            return header.attrHandle;
-        }
+        throw std::invalid_argument("Unknow attribute Name");
     }
 
-    throw std::invalid_argument("Unknow attribute Name");
+    return table::attribute::decodeHeader(entry).attrHandle;
 }
 
 void BIOSConfig::constructPendingAttribute(
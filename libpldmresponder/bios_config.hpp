@@ -11,7 +11,9 @@
 
 #include <nlohmann/json.hpp>
 #include <phosphor-logging/lg2.hpp>
+#include <sdbusplus/timer.hpp>
 
+#include <array>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -70,7 +72,7 @@ class BIOSConfig
     BIOSConfig(BIOSConfig&&) = delete;
     BIOSConfig& operator=(const BIOSConfig&) = delete;
     BIOSConfig& operator=(BIOSConfig&&) = delete;
-    ~BIOSConfig() = default;
+    ~BIOSConfig();
 
     /** @brief Construct BIOSConfig
      *  @param[in] jsonDir - The directory where json file exists
@@ -110,9 +112,17 @@ class BIOSConfig
 
     /** @brief Get BIOS table of specified type
      *  @param[in] tableType - The table type
-     *  @return The bios table, std::nullopt if the table is unaviliable
+     *  @return The bios table, nullptr if the table is unavailable. It is
+     *          valid until the table is set again.
      */
-    std::optional<Table> getBIOSTable(pldm_bios_table_types tableType);
+    const Table* getBIOSTable(uint8_t tableType) const;
+
+    /** @brief Get the generation of a BIOS table, it changes every time the
+     *         table is set
+     *  @param[in] tableType - The table type
+     *  @return The generation of the table
+     */
+    uint32_t getBIOSTableGeneration(uint8_t tableType) const;
 
     /** @brief set BIOS table
      *  @param[in] tableType - Indicates what table is being transferred
@@ -126,6 +136,24 @@ class BIOSConfig
     int setBIOSTable(uint8_t tableType, const Table& table,
                      bool updateBaseBIOSTable = true);
 
+    /** @brief Queue the tables modified since the last flush to be
+     *         persisted by the table writer
+     */
+    void flushTables();
+
+    /** @brief Persist the tables modified since the last flush and wait
+     *         until they are written
+     */
+    void syncTables();
+
+    /** @brief Get the number of table files written so far, each of them is
+     *         synced to storage once
+     */
+    uint64_t getTableWrites() const
+    {
+        return tableWriter.getWrites();
+    }
+
   private:
     /** @enum Index into the fields in the BaseBIOSTable
      */
@@ -179,6 +207,51 @@ class BIOSConfig
     /** @brief system type/model */
     std::string sysType;
 
+    static constexpr size_t numTables = PLDM_BIOS_ATTR_VAL_TABLE + 1;
+
+    /** @brief The BIOS tables indexed by table type, empty if unavailable.
+     *         They are served from memory and written behind to tableDir.
+     */
+    std::array<Table, numTables> tables;
+
+    /** @brief Lookups into the string table, rebuilt with the table */
+    std::optional<BIOSStringTable> stringLookup;
+
+    /** @brief Index of the attribute table, rebuilt with the table */
+    std::optional<BIOSAttrTableIndex> attrLookup;
+
+    /** @brief Index of the attribute value table, rebuilt with the table */
+    std::optional<BIOSAttrValueTableIndex> attrValueLookup;
+
+    /** @brief Generation of each table */
+    std::array<uint32_t, numTables> tableGenerations{};
+
+    /** @brief Tables modified since they were last persisted */
+    std::array<bool, numTables> dirtyTables{};
+
+    /** @brief Writes the tables off the event loop */
+    BIOSTableWriter tableWriter;
+
+    /** @brief Batches the writes of the modified tables */
+    sdbusplus::Timer persistTimer;
+
+    /** @brief Update a table in memory and schedule its persistence
+     *  @param[in] tableType - The table type
+     *  @param[in] table - The table
+     */
+    void cacheTable(pldm_bios_table_types tableType, Table&& table);
+
+    /** @brief Bump the generation of a table modified in memory and schedule
+     *         its persistence
+     *  @param[in] tableType - The table type
+     */
+    void tableChanged(pldm_bios_table_types tableType);
+
+    /** @brief Rebuild the lookups of a table after it changed
+     *  @param[in] tableType - The table type
+     */
+    void indexTable(pldm_bios_table_types tableType);
+
     /** @brief Method to update a BIOS attribute when the corresponding Dbus
      *  property is changed
      *  @param[in] chProperties - list of properties which have changed
@@ -267,11 +340,11 @@ class BIOSConfig
      */
     void buildAndStoreAttrTables(const Table& stringTable);
 
-    /** @brief Persist the table
-     *  @param[in] path - Path to persist the table
-     *  @param[in] table - The table
+    /** @brief Get the path the table of a type is persisted to
+     *  @param[in] tableType - The table type
+     *  @return The path of the table
      */
-    void storeTable(const fs::path& path, const Table& table);
+    fs::path tablePath(pldm_bios_table_types tableType) const;
 
     /** @brief Load bios table to ram
      *  @param[in] path - Path of the table
@@ -292,14 +365,10 @@ class BIOSConfig
      *
      *  @param[in] handle - the Attribute handle of the bios attribute
      *  @param[in] index - index to the possible value handles
-     *  @param[in] attrTable - the attribute table
-     *  @param[in] stringTable - the string table
      *  @return string handle from the string table and decoded string to the
      * name handle
      */
-    std::string displayStringHandle(uint16_t handle, uint8_t index,
-                                    const std::optional<Table>& attrTable,
-                                    const std::optional<Table>& stringTable);
+    std::string displayStringHandle(uint16_t handle, uint8_t index);
 
     /** @brief Method to trace the bios attribute which got changed
      *
@@ -319,7 +388,8 @@ class BIOSConfig
      */
     int checkAttrValueToUpdate(
         const pldm_bios_attr_val_table_entry* attrValueEntry,
-        const pldm_bios_attr_table_entry* attrEntry, Table& stringTable);
+        const pldm_bios_attr_table_entry* attrEntry,
+        const Table& stringTable);
 
     /** @brief Check the attribute table
      *  @param[in] table - The table
@@ -333,6 +403,14 @@ class BIOSConfig
      */
     int checkAttributeValueTable(const Table& table);
 
+    /** @brief Check an entry of the attribute value table and update its
+     *         attribute in baseBIOSTableMaps
+     *  @param[in] tableEntry - The attribute value table entry
+     *  @return pldm_completion_codes
+     */
+    int checkAttributeValueEntry(
+        const pldm_bios_attr_val_table_entry* tableEntry);
+
     /** @brief Update the BaseBIOSTable property of the D-Bus interface
      */
     void updateBaseBIOSTableProperty();
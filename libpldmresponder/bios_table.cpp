@@ -1,11 +1,21 @@
 #include "bios_table.hpp"
 
+#include "common/bios_utils.hpp"
+
 #include <libpldm/base.h>
 #include <libpldm/bios_table.h>
 #include <libpldm/utils.h>
 
+#include <endian.h>
+#include <fcntl.h>
+#include <unistd.h>
+
 #include <phosphor-logging/lg2.hpp>
 
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 
 namespace pldm
@@ -32,8 +42,49 @@ bool BIOSTable::isEmpty() const noexcept
 
 void BIOSTable::store(const Table& table)
 {
-    std::ofstream stream(filePath.string(), std::ios::out | std::ios::binary);
-    stream.write(reinterpret_cast<const char*>(table.data()), table.size());
+    // Write a temporary file and rename it over the table so a crash never
+    // leaves a partially written table behind
+    auto tmpPath = filePath.string() + ".tmp";
+    int fd = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                  0644);
+    if (fd < 0)
+    {
+        lg2::error("Failed to open BIOS table {PATH}, errno = {ERRNO}", "PATH",
+                   tmpPath, "ERRNO", errno);
+        return;
+    }
+
+    size_t written = 0;
+    while (written < table.size())
+    {
+        auto rc = write(fd, table.data() + written, table.size() - written);
+        if (rc < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (rc < 0)
+        {
+            break;
+        }
+        written += rc;
+    }
+
+    if (written != table.size() || fsync(fd) < 0)
+    {
+        lg2::error("Failed to write BIOS table {PATH}, errno = {ERRNO}",
+                   "PATH", tmpPath, "ERRNO", errno);
+        close(fd);
+        unlink(tmpPath.c_str());
+        return;
+    }
+    close(fd);
+
+    if (rename(tmpPath.c_str(), filePath.c_str()) < 0)
+    {
+        lg2::error("Failed to rename BIOS table {PATH}, errno = {ERRNO}",
+                   "PATH", filePath, "ERRNO", errno);
+        unlink(tmpPath.c_str());
+    }
 }
 
 void BIOSTable::load(Response& response) const
@@ -45,19 +96,109 @@ void BIOSTable::load(Response& response) const
     stream.read(reinterpret_cast<char*>(response.data() + currSize), fileSize);
 }
 
+BIOSTableWriter::BIOSTableWriter() :
+    worker(&BIOSTableWriter::run, this)
+{}
+
+BIOSTableWriter::~BIOSTableWriter()
+{
+    {
+        std::lock_guard guard(lock);
+        stopping = true;
+    }
+    wakeup.notify_one();
+    worker.join();
+}
+
+void BIOSTableWriter::submit(const fs::path& path, Table&& table)
+{
+    {
+        std::lock_guard guard(lock);
+        queued.insert_or_assign(path, std::move(table));
+    }
+    wakeup.notify_one();
+}
+
+void BIOSTableWriter::wait()
+{
+    std::unique_lock guard(lock);
+    idle.wait(guard, [this]() { return queued.empty() && !busy; });
+}
+
+uint64_t BIOSTableWriter::getWrites() const
+{
+    std::lock_guard guard(lock);
+    return writes;
+}
+
+void BIOSTableWriter::run()
+{
+    std::unique_lock guard(lock);
+    while (true)
+    {
+        wakeup.wait(guard, [this]() { return stopping || !queued.empty(); });
+        if (queued.empty())
+        {
+            /* Stopping, with every queued table written */
+            return;
+        }
+
+        auto node = queued.extract(queued.begin());
+        busy = true;
+        guard.unlock();
+
+        BIOSTable(node.key().c_str()).store(node.mapped());
+
+        guard.lock();
+        busy = false;
+        writes++;
+        if (queued.empty())
+        {
+            idle.notify_all();
+        }
+    }
+}
+
 BIOSStringTable::BIOSStringTable(const Table& stringTable) :
     stringTable(stringTable)
-{}
+{
+    buildIndex();
+}
 
 BIOSStringTable::BIOSStringTable(const BIOSTable& biosTable)
 {
     biosTable.load(stringTable);
+    buildIndex();
+}
+
+void BIOSStringTable::buildIndex()
+{
+    for (auto entry : pldm::bios::utils::BIOSTableIter<PLDM_BIOS_STRING_TABLE>(
+             stringTable.data(), stringTable.size()))
+    {
+        auto handle = table::string::decodeHandle(entry);
+        // Keep the first entry of a duplicated string, as a scan would
+        handles.emplace(table::string::decodeString(entry), handle);
+        offsets.emplace(handle, reinterpret_cast<const uint8_t*>(entry) -
+                                    stringTable.data());
+    }
+}
+
+const pldm_bios_string_table_entry*
+    BIOSStringTable::findEntry(uint16_t handle) const
+{
+    auto it = offsets.find(handle);
+    if (it == offsets.end())
+    {
+        return nullptr;
+    }
+    return reinterpret_cast<const pldm_bios_string_table_entry*>(
+        stringTable.data() + it->second);
 }
 
 std::string BIOSStringTable::findString(uint16_t handle) const
 {
-    auto stringEntry = pldm_bios_table_string_find_by_handle(
-        stringTable.data(), stringTable.size(), handle);
+    auto stringEntry = findEntry(handle);
     if (stringEntry == nullptr)
     {
         throw std::invalid_argument("Invalid String Handle");
@@ -67,14 +208,123 @@ std::string BIOSStringTable::findString(uint16_t handle) const
 
 uint16_t BIOSStringTable::findHandle(const std::string& name) const
 {
-    auto stringEntry = pldm_bios_table_string_find_by_string(
-        stringTable.data(), stringTable.size(), name.c_str());
-    if (stringEntry == nullptr)
+    auto it = handles.find(name);
+    if (it == handles.end())
     {
         throw std::invalid_argument("Invalid String Name");
     }
 
-    return table::string::decodeHandle(stringEntry);
+    return it->second;
+}
+
+BIOSAttrTableIndex::BIOSAttrTableIndex(const Table& attrTable)
+{
+    for (auto entry : pldm::bios::utils::BIOSTableIter<PLDM_BIOS_ATTR_TABLE>(
+             attrTable.data(), attrTable.size()))
+    {
+        auto header = table::attribute::decodeHeader(entry);
+        auto offset = reinterpret_cast<const uint8_t*>(entry) -
+                      attrTable.data();
+        offsets.emplace(header.attrHandle, offset);
+        stringHandleOffsets.emplace(header.stringHandle, offset);
+    }
+}
+
+const pldm_bios_attr_table_entry*
+    BIOSAttrTableIndex::findByHandle(const Table& attrTable,
+                                     uint16_t handle) const
+{
+    auto it = offsets.find(handle);
+    if (it == offsets.end() || it->second >= attrTable.size())
+    {
+        return nullptr;
+    }
+    return reinterpret_cast<const pldm_bios_attr_table_entry*>(
+        attrTable.data() + it->second);
+}
+
+const pldm_bios_attr_table_entry*
+    BIOSAttrTableIndex::findByStringHandle(const Table& attrTable,
+                                           uint16_t handle) const
+{
+    auto it = stringHandleOffsets.find(handle);
+    if (it == stringHandleOffsets.end() || it->second >= attrTable.size())
+    {
+        return nullptr;
+    }
+    return reinterpret_cast<const pldm_bios_attr_table_entry*>(
+        attrTable.data() + it->second);
+}
+
+BIOSAttrValueTableIndex::BIOSAttrValueTableIndex(const Table& attrValueTable)
+{
+    for (auto entry :
+         pldm::bios::utils::BIOSTableIter<PLDM_BIOS_ATTR_VAL_TABLE>(
+             attrValueTable.data(), attrValueTable.size()))
+    {
+        auto header = table::attribute_value::decodeHeader(entry);
+        offsets.emplace(header.attrHandle,
+                        reinterpret_cast<const uint8_t*>(entry) -
+                            attrValueTable.data());
+    }
+}
+
+const pldm_bios_attr_val_table_entry*
+    BIOSAttrValueTableIndex::findByHandle(const Table& attrValueTable,
+                                          uint16_t handle) const
+{
+    auto it = offsets.find(handle);
+    if (it == offsets.end() || it->second >= attrValueTable.size())
+    {
+        return nullptr;
+    }
+    return reinterpret_cast<const pldm_bios_attr_val_table_entry*>(
+        attrValueTable.data() + it->second);
+}
+
+BIOSTableTransfer::BIOSTableTransfer(size_t maxPartSize) :
+    maxPartSize(maxPartSize ? maxPartSize : SIZE_MAX)
+{}
+
+int BIOSTableTransfer::getPart(uint8_t tableType, uint32_t generation,
+                               size_t tableSize, uint32_t transferHandle,
+                               uint8_t transferOpFlag, Part& part)
+{
+    size_t offset = 0;
+    if (transferOpFlag == PLDM_GET_FIRSTPART)
+    {
+        transfers[tableType] = generation;
+    }
+    else if (transferOpFlag == PLDM_GET_NEXTPART)
+    {
+        auto it = transfers.find(tableType);
+        if (it == transfers.end() || it->second != generation ||
+            transferHandle == 0 || transferHandle >= tableSize)
+        {
+            return invalidDataTransferHandle;
+        }
+        offset = transferHandle;
+    }
+    else
+    {
+        return invalidTransferOperationFlag;
+    }
+
+    part.offset = offset;
+    part.length = std::min(tableSize - offset, maxPartSize);
+    bool last = offset + part.length == tableSize;
+    if (offset == 0)
+    {
+        part.transferFlag = last ? PLDM_START_AND_END : PLDM_START;
+    }
+    else
+    {
+        part.transferFlag = last ? PLDM_END : PLDM_MIDDLE;
+    }
+    // The transfer stays valid after the last part so it can be retried
+    part.nextTransferHandle = last ? 0 : offset + part.length;
+
+    return PLDM_SUCCESS;
 }
 
 namespace table
@@ -391,6 +641,25 @@ std::optional<Table> updateTable(const Table& table, const void* entry,
     return destTable;
 }
 
+bool replaceEntry(Table& table, const pldm_bios_attr_val_table_entry* oldEntry,
+                  const void* entry, size_t size)
+{
+    uint32_t checksum;
+    auto offset = reinterpret_cast<const uint8_t*>(oldEntry) - table.data();
+    if (pldm_bios_table_attr_value_entry_length(oldEntry) != size ||
+        offset + size + sizeof(checksum) > table.size())
+    {
+        return false;
+    }
+
+    // The table keeps its length and so its pad, only the checksum changes
+    std::memcpy(table.data() + offset, entry, size);
+    checksum = htole32(crc32(table.data(), table.size() - sizeof(checksum)));
+    std::memcpy(table.data() + table.size() - sizeof(checksum), &checksum,
+                sizeof(checksum));
+    return true;
+}
+
 } // namespace attribute_value
 
 } // namespace table
@@ -4,9 +4,14 @@
 #include <libpldm/bios_table.h>
 #include <stdint.h>
 
+#include <condition_variable>
 #include <filesystem>
+#include <map>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 namespace pldm
@@ -56,6 +61,9 @@ class BIOSTable
     bool isEmpty() const noexcept;
 
     /** @brief Persist a BIOS table(string/attribute/attribute value)
+     *
+     *  @details The table is written to a temporary file, synced and renamed
+     *  over the persisted table.
      *
      *  @param[in] table - BIOS table
      */
@@ -73,6 +81,57 @@ class BIOSTable
     fs::path filePath;
 };
 
+/** @class BIOSTableWriter
+ *
+ *  @brief Persists BIOS tables on a worker thread
+ *
+ *  @details Writing and syncing a table file is left to the worker so that it
+ *  does not stall the event loop. A table queued while an older copy of the
+ *  same file still waits for the worker replaces that copy.
+ */
+class BIOSTableWriter
+{
+  public:
+    /** @brief Constructor, starts the worker */
+    BIOSTableWriter();
+
+    /** @brief Destructor, writes the tables still queued and stops the
+     *         worker
+     */
+    ~BIOSTableWriter();
+
+    BIOSTableWriter(const BIOSTableWriter&) = delete;
+    BIOSTableWriter& operator=(const BIOSTableWriter&) = delete;
+
+    /** @brief Queue a table to persist
+     *
+     *  @param[in] path - file the table is persisted to
+     *  @param[in] table - BIOS table
+     */
+    void submit(const fs::path& path, Table&& table);
+
+    /** @brief Wait until the tables queued so far are written */
+    void wait();
+
+    /** @brief Get the number of table files written so far */
+    uint64_t getWrites() const;
+
+  private:
+    /** @brief Worker thread body */
+    void run();
+
+    mutable std::mutex lock;
+    std::condition_variable wakeup;
+    std::condition_variable idle;
+    bool stopping = false;
+    /** @brief Whether the worker is writing a table */
+    bool busy = false;
+    /** @brief Tables waiting for the worker by file */
+    std::map<fs::path, Table> queued;
+    uint64_t writes = 0;
+    std::thread worker;
+};
+
 /** @class BIOSStringTableInterface
  *  @brief Provide interfaces to the BIOS string table operations
  */
@@ -98,6 +157,8 @@ class BIOSStringTableInterface
 
 /** @class BIOSStringTable
  *  @brief Collection of BIOS string table operations.
+ *  @details The strings are indexed by name and by handle when the table is
+ *  constructed, so the lookups don't scan the table.
  */
 class BIOSStringTable : public BIOSStringTableInterface
 {
@@ -130,8 +191,140 @@ class BIOSStringTable : public BIOSStringTableInterface
      */
     uint16_t findHandle(const std::string& name) const override;
 
+    /** @brief Find the string table entry of a string handle
+     *  @param[in] handle - string handle
+     *  @return Pointer to the string table entry, nullptr if not found
+     */
+    const pldm_bios_string_table_entry* findEntry(uint16_t handle) const;
+
   private:
+    /** @brief Index the string entries of the table */
+    void buildIndex();
+
     Table stringTable;
+    /** @brief String handle of each string */
+    std::unordered_map<std::string, uint16_t> handles;
+    /** @brief Offset in the table of the entry of each string handle */
+    std::unordered_map<uint16_t, size_t> offsets;
+};
+
+/** @class BIOSAttrTableIndex
+ *  @brief Index of the entries of a BIOS attribute table by attribute handle
+ *         and by attribute name string handle
+ *  @details The index keeps the offsets of the entries, it can be used with
+ *  the table it was built from or any copy of it.
+ */
+class BIOSAttrTableIndex
+{
+  public:
+    /** @brief Constructs BIOSAttrTableIndex
+     *
+     *  @param[in] attrTable - The attribute table
+     */
+    explicit BIOSAttrTableIndex(const Table& attrTable);
+
+    /** @brief Find attribute entry by handle
+     *  @param[in] attrTable - the indexed attribute table
+     *  @param[in] handle - attribute handle
+     *  @return Pointer to the attribute table entry, nullptr if not found
+     */
+    const pldm_bios_attr_table_entry* findByHandle(const Table& attrTable,
+                                                   uint16_t handle) const;
+
+    /** @brief Find attribute entry by string handle
+     *  @param[in] attrTable - the indexed attribute table
+     *  @param[in] handle - string handle
+     *  @return Pointer to the attribute table entry, nullptr if not found
+     */
+    const pldm_bios_attr_table_entry*
+        findByStringHandle(const Table& attrTable, uint16_t handle) const;
+
+  private:
+    /** @brief Offset of the entry of each attribute handle */
+    std::unordered_map<uint16_t, size_t> offsets;
+    /** @brief Offset of the entry of each attribute name string handle */
+    std::unordered_map<uint16_t, size_t> stringHandleOffsets;
+};
+
+/** @class BIOSAttrValueTableIndex
+ *  @brief Index of the entries of a BIOS attribute value table by attribute
+ *         handle
+ *  @details Like BIOSAttrTableIndex, the index keeps the offsets of the
+ *  entries. It stays valid when an entry is replaced in place.
+ */
+class BIOSAttrValueTableIndex
+{
+  public:
+    /** @brief Constructs BIOSAttrValueTableIndex
+     *
+     *  @param[in] attrValueTable - The attribute value table
+     */
+    explicit BIOSAttrValueTableIndex(const Table& attrValueTable);
+
+    /** @brief Find attribute value entry by attribute handle
+     *  @param[in] attrValueTable - the indexed attribute value table
+     *  @param[in] handle - attribute handle
+     *  @return Pointer to the attribute value table entry, nullptr if not
+     *          found
+     */
+    const pldm_bios_attr_val_table_entry*
+        findByHandle(const Table& attrValueTable, uint16_t handle) const;
+
+  private:
+    /** @brief Offset of the entry of each attribute handle */
+    std::unordered_map<uint16_t, size_t> offsets;
+};
+
+/** @class BIOSTableTransfer
+ *  @brief Splits the BIOS tables into the parts of multipart GetBIOSTable
+ *         transfers
+ *  @details The transfer handle of a part is its offset in the table. A
+ *  transfer is bound to the generation of the table it started on, so a table
+ *  replaced in the middle of a transfer fails the remaining parts instead of
+ *  mixing two tables.
+ */
+class BIOSTableTransfer
+{
+  public:
+    /** @brief DSP0247 completion codes libpldm does not define */
+    static constexpr uint8_t invalidDataTransferHandle = 0x80;
+    static constexpr uint8_t invalidTransferOperationFlag = 0x81;
+
+    /** @struct Part
+     *  @brief The part of a table to send in a GetBIOSTable response
+     */
+    struct Part
+    {
+        size_t offset;
+        size_t length;
+        uint32_t nextTransferHandle;
+        uint8_t transferFlag;
+    };
+
+    /** @brief Constructs BIOSTableTransfer
+     *
+     *  @param[in] maxPartSize - maximum number of table bytes in a part, 0
+     *                          to send the tables in a single part
+     */
+    explicit BIOSTableTransfer(size_t maxPartSize);
+
+    /** @brief Get the part of a table requested by a GetBIOSTable request
+     *
+     *  @param[in] tableType - type of the requested table
+     *  @param[in] generation - generation of the table
+     *  @param[in] tableSize - size of the table
+     *  @param[in] transferHandle - transfer handle of the request
+     *  @param[in] transferOpFlag - transfer operation flag of the request
+     *  @param[out] part - the part to send
+     *  @return pldm_completion_codes
+     */
+    int getPart(uint8_t tableType, uint32_t generation, size_t tableSize,
+                uint32_t transferHandle, uint8_t transferOpFlag, Part& part);
+
+  private:
+    const size_t maxPartSize;
+    /** @brief Table generation of the transfer in progress of each table */
+    std::map<uint8_t, uint32_t> transfers;
 };
 
 namespace table
@@ -369,6 +562,18 @@ const pldm_bios_attr_val_table_entry*
 std::optional<Table> updateTable(const Table& table, const void* entry,
                                  size_t size);
 
+/** @brief Replace an entry of the table in place
+ *  @details Only an entry of the same length can be replaced in place, the
+ *  checksum of the table is updated.
+ *  @param[in,out] table - the table need to be updated
+ *  @param[in] oldEntry - the entry of the table to replace
+ *  @param[in] entry - the new attribute value entry
+ *  @param[in] size - size of the new entry
+ *  @return true if the entry was replaced
+ */
+bool replaceEntry(Table& table, const pldm_bios_attr_val_table_entry* oldEntry,
+                  const void* entry, size_t size);
+
 } // namespace attribute_value
 
 } // namespace table
@@ -9,6 +9,8 @@
 #include <phosphor-logging/lg2.hpp>
 #include <sdbusplus/bus.hpp>
 
+#include <algorithm>
+#include <cstdint>
 #include <optional>
 #include <set>
 #include <stack>
@@ -22,6 +24,32 @@ namespace responder
 
 constexpr auto root = "/xyz/openbmc_project/inventory/";
 
+/** @brief Check the Present property of a FRU inventory object
+ *
+ *  @param[in] interfaces - interfaces and properties of the object
+ *
+ *  @return true if the FRU is present
+ */
+static bool isFruPresent(const dbus::InterfaceMap& interfaces)
+{
+    static constexpr auto presentInterface =
+        "xyz.openbmc_project.Inventory.Item";
+    static constexpr auto presentProperty = "Present";
+
+    auto intf = interfaces.find(presentInterface);
+    if (intf == interfaces.end())
+    {
+        return false;
+    }
+    auto prop = intf->second.find(presentProperty);
+    if (prop == intf->second.end())
+    {
+        return false;
+    }
+    auto present = std::get_if<bool>(&prop->second);
+    return present && *present;
+}
+
 std::optional<pldm_entity>
     FruImpl::getEntityByObjectPath(const dbus::InterfaceMap& intfMaps)
 {
@@ -152,6 +180,8 @@ void FruImpl::buildFRUTable()
     try
     {
         dbusInfo = parser.inventoryLookup();
+        // Subscribe first so no change after the snapshot is missed
+        subscribeInventory(dbusInfo);
         auto method = bus.new_method_call(
             std::get<0>(dbusInfo).c_str(), std::get<1>(dbusInfo).c_str(),
             "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
@@ -165,55 +195,38 @@ void FruImpl::buildFRUTable()
         return;
     }
 
-    auto itemIntfsLookup = std::get<2>(dbusInfo);
+    buildFRUTable(objects);
+}
+
+void FruImpl::buildFRUTable(const dbus::ObjectValueTree& objects)
+{
+    if (isBuilt)
+    {
+        return;
+    }
+
+    inventory = objects;
+    itemInterfaces = std::get<2>(parser.inventoryLookup());
 
-    for (const auto& object : objects)
+    for (const auto& [path, interfaces] : inventory)
     {
-        const auto& interfaces = object.second;
         for (const auto& interface : interfaces)
         {
-            if (itemIntfsLookup.find(interface.first) != itemIntfsLookup.end())
+            if (itemInterfaces.contains(interface.first))
             {
-                // checking fru present property is available or not.
-                if (!pldm::utils::checkForFruPresence(object.first.str))
-                {
-                    continue;
-                }
-
-                // An exception will be thrown by getRecordInfo, if the item
-                // D-Bus interface name specified in FRU_Master.json does
-                // not have corresponding config jsons
-                try
-                {
-                    updateAssociationTree(objects, object.first.str);
-                    pldm_entity entity{};
-                    if (objToEntityNode.contains(object.first.str))
-                    {
-                        pldm_entity_node* node =
-                            objToEntityNode.at(object.first.str);
-
-                        entity = pldm_entity_extract(node);
-                    }
-
-                    auto recordInfos = parser.getRecordInfo(interface.first);
-                    populateRecords(interfaces, recordInfos, entity);
-
-                    associatedEntityMap.emplace(object.first, entity);
-                    break;
-                }
-                catch (const std::exception& e)
+                // The presence is part of the GetManagedObjects payload
+                if (isFruPresent(interfaces))
                 {
-                    error(
-                        "Config JSONs missing for the item interface type, interface = {INTF}",
-                        "INTF", interface.first);
-                    break;
+                    addFru(path, interface.first);
                 }
+                break;
             }
         }
     }
 
     int rc = pldm_entity_association_pdr_add_check(entityTree, pdrRepo, false,
                                                    TERMINUS_HANDLE);
+    pldm::utils::pdrRepoChanged(pdrRepo);
     if (rc < 0)
     {
         // pldm_entity_assocation_pdr_add() assert()ed on failure
@@ -225,10 +238,311 @@ void FruImpl::buildFRUTable()
     // save a copy of bmc's entity association tree
     pldm_entity_association_tree_copy_root(entityTree, bmcEntityTree);
 
+    updateTable();
     isBuilt = true;
 }
+
+void FruImpl::subscribeInventory(const fru_parser::DBusLookupInfo& dbusInfo)
+{
+    if (!inventoryMatches.empty())
+    {
+        return;
+    }
+
+    namespace rules = sdbusplus::bus::match::rules;
+    auto& bus = pldm::utils::DBusHandler::getBus();
+    const auto& objectManager = std::get<1>(dbusInfo);
+
+    inventoryMatches.emplace_back(std::make_unique<sdbusplus::bus::match_t>(
+        bus, rules::interfacesAdded(objectManager),
+        [this](sdbusplus::message_t& msg) {
+        sdbusplus::message::object_path path;
+        dbus::InterfaceMap interfaces;
+        try
+        {
+            msg.read(path, interfaces);
+        }
+        catch (const std::exception& e)
+        {
+            error(
+                "Failed to read the inventory InterfacesAdded signal: {ERROR}",
+                "ERROR", e);
+            return;
+        }
+        interfacesAdded(path.str, interfaces);
+    }));
+
+    inventoryMatches.emplace_back(std::make_unique<sdbusplus::bus::match_t>(
+        bus, rules::interfacesRemoved(objectManager),
+        [this](sdbusplus::message_t& msg) {
+        sdbusplus::message::object_path path;
+        std::vector<std::string> interfaces;
+        try
+        {
+            msg.read(path, interfaces);
+        }
+        catch (const std::exception& e)
+        {
+            error(
+                "Failed to read the inventory InterfacesRemoved signal: {ERROR}",
+                "ERROR", e);
+            return;
+        }
+        interfacesRemoved(path.str, interfaces);
+    }));
+
+    inventoryMatches.emplace_back(std::make_unique<sdbusplus::bus::match_t>(
+        bus,
+        rules::type::signal() + rules::member("PropertiesChanged") +
+            rules::interface("org.freedesktop.DBus.Properties") +
+            rules::path_namespace(objectManager),
+        [this](sdbusplus::message_t& msg) {
+        dbus::Interface interface;
+        dbus::PropertyMap properties;
+        try
+        {
+            msg.read(interface, properties);
+        }
+        catch (const std::exception& e)
+        {
+            error(
+                "Failed to read the inventory PropertiesChanged signal: {ERROR}",
+                "ERROR", e);
+            return;
+        }
+        propertiesChanged(msg.get_path(), interface, properties);
+    }));
+}
+
+void FruImpl::interfacesAdded(const dbus::ObjectPath& path,
+                              const dbus::InterfaceMap& interfaces)
+{
+    if (!isBuilt)
+    {
+        return;
+    }
+
+    auto& object = inventory[path];
+    for (const auto& [interface, properties] : interfaces)
+    {
+        object[interface] = properties;
+    }
+    updateFru(path);
+}
+
+void FruImpl::interfacesRemoved(const dbus::ObjectPath& path,
+                                const std::vector<std::string>& interfaces)
+{
+    if (!isBuilt)
+    {
+        return;
+    }
+
+    auto it = inventory.find(path);
+    if (it == inventory.end())
+    {
+        return;
+    }
+    for (const auto& interface : interfaces)
+    {
+        it->second.erase(interface);
+    }
+    if (it->second.empty())
+    {
+        inventory.erase(it);
+    }
+    updateFru(path);
+}
+
+void FruImpl::propertiesChanged(const dbus::ObjectPath& path,
+                                const dbus::Interface& interface,
+                                const dbus::PropertyMap& properties)
+{
+    if (!isBuilt)
+    {
+        return;
+    }
+
+    auto it = inventory.find(path);
+    if (it == inventory.end())
+    {
+        return;
+    }
+    auto& object = it->second;
+    for (const auto& [property, value] : properties)
+    {
+        object[interface][property] = value;
+    }
+    updateFru(path);
+}
+
+void FruImpl::updateFru(const dbus::ObjectPath& path)
+{
+    std::optional<dbus::Interface> itemInterface;
+    auto it = inventory.find(path);
+    if (it != inventory.end() && isFruPresent(it->second))
+    {
+        for (const auto& interface : it->second)
+        {
+            if (itemInterfaces.contains(interface.first))
+            {
+                itemInterface = interface.first;
+                break;
+            }
+        }
+    }
+
+    auto fruIt = fruRecordSets.find(path);
+    if (!itemInterface)
+    {
+        if (fruIt == fruRecordSets.end())
+        {
+            return;
+        }
+        removeFru(path);
+    }
+    else if (fruIt == fruRecordSets.end() ||
+             fruIt->second.itemInterface != *itemInterface)
+    {
+        removeFru(path);
+        addFru(path, *itemInterface);
+    }
+    else
+    {
+        // Rebuild the records in place, the FRU keeps its record set
+        auto& recordSet = fruIt->second;
+        auto rsi = recordSet.rsi;
+        auto records = std::move(recordSet.records);
+        populateRecords(it->second,
+                        parser.getRecordInfo(recordSet.itemInterface),
+                        recordSet);
+        if (!rsi && recordSet.rsi)
+        {
+            rsiToObj.emplace(recordSet.rsi, path);
+        }
+        if (records == recordSet.records)
+        {
+            return;
+        }
+    }
+
+    updateTable();
+}
+
+void FruImpl::addFru(const dbus::ObjectPath& path,
+                     const dbus::Interface& itemInterface)
+{
+    // An exception will be thrown by getRecordInfo, if the item
+    // D-Bus interface name specified in FRU_Master.json does
+    // not have corresponding config jsons
+    try
+    {
+        updateAssociationTree(inventory, path);
+        FruRecordSet recordSet{};
+        recordSet.itemInterface = itemInterface;
+        if (objToEntityNode.contains(path))
+        {
+            pldm_entity_node* node = objToEntityNode.at(path);
+
+            recordSet.entity = pldm_entity_extract(node);
+        }
+
+        auto recordInfos = parser.getRecordInfo(itemInterface);
+        populateRecords(inventory.at(path), recordInfos, recordSet);
+
+        associatedEntityMap.emplace(path, recordSet.entity);
+        if (recordSet.rsi)
+        {
+            rsiToObj.emplace(recordSet.rsi, path);
+        }
+        fruRecordSets.emplace(path, std::move(recordSet));
+    }
+    catch (const std::exception& e)
+    {
+        error(
+            "Config JSONs missing for the item interface type, interface = {INTF}",
+            "INTF", itemInterface);
+    }
+}
+
+void FruImpl::removeFru(const dbus::ObjectPath& path)
+{
+    auto it = fruRecordSets.find(path);
+    if (it == fruRecordSets.end())
+    {
+        return;
+    }
+
+    if (it->second.rsi)
+    {
+        uint32_t recordHandle = 0;
+        int rc = pldm_pdr_remove_fru_record_set_by_rsi(
+            pdrRepo, it->second.rsi, false, &recordHandle);
+        pldm::utils::pdrRepoChanged(pdrRepo);
+        if (rc)
+        {
+            error(
+                "Failed to remove the FRU record set PDR, RSI={RSI} RC={RC}",
+                "RSI", it->second.rsi, "RC", rc);
+        }
+        rsiToObj.erase(it->second.rsi);
+    }
+
+    // The entity stays in the association tree while it contains others
+    auto node = objToEntityNode.find(path);
+    if (node != objToEntityNode.end() &&
+        !pldm_entity_is_node_parent(node->second))
+    {
+        pldm_entity_association_tree_delete_node(entityTree,
+                                                 &it->second.entity);
+        objToEntityNode.erase(node);
+    }
+
+    associatedEntityMap.erase(path);
+    fruRecordSets.erase(it);
+}
+
+void FruImpl::updateTable()
+{
+    size_t recordsSize = 0;
+    for (const auto& [rsi, path] : rsiToObj)
+    {
+        recordsSize += fruRecordSets.at(path).records.size();
+    }
+
+    table.clear();
+    table.reserve(recordsSize + 3 + sizeof(checksum));
+    numRecs = 0;
+    for (const auto& [rsi, path] : rsiToObj)
+    {
+        const auto& recordSet = fruRecordSets.at(path);
+        table.insert(table.end(), recordSet.records.begin(),
+                     recordSet.records.end());
+        numRecs += recordSet.numRecords;
+    }
+
+    // The table is kept as sent, padded and followed by its checksum
+    checksum = 0;
+    padBytes = pldm::utils::getNumPadBytes(table.size());
+    table.resize(table.size() + padBytes, 0);
+    if (numRecs)
+    {
+        checksum = crc32(table.data(), table.size());
+    }
+    table.insert(table.end(), reinterpret_cast<const uint8_t*>(&checksum),
+                 reinterpret_cast<const uint8_t*>(&checksum) +
+                     sizeof(checksum));
+    generation++;
+}
+
 std::string FruImpl::populatefwVersion()
 {
+    // The running version only changes with a BMC reboot
+    if (bmcVersion)
+    {
+        return *bmcVersion;
+    }
+
     static constexpr auto fwFunctionalObjPath =
         "/xyz/openbmc_project/software/functional";
     auto& bus = pldm::utils::DBusHandler::getBus();
@@ -254,18 +568,21 @@ std::string FruImpl::populatefwVersion()
               "ERR_EXCEP", e.what());
         return {};
     }
+    bmcVersion = currentBmcVersion;
     return currentBmcVersion;
 }
 void FruImpl::populateRecords(
     const pldm::responder::dbus::InterfaceMap& interfaces,
-    const fru_parser::FruRecordInfos& recordInfos, const pldm_entity& entity)
+    const fru_parser::FruRecordInfos& recordInfos, FruRecordSet& recordSet)
 {
     // recordSetIdentifier for the FRU will be set when the first record gets
     // added for the FRU
-    uint16_t recordSetIdentifier = 0;
-    auto numRecsCount = numRecs;
+    const auto& entity = recordSet.entity;
     static uint32_t bmc_record_handle = 0;
 
+    recordSet.records.clear();
+    recordSet.numRecords = 0;
+
     for (const auto& [recType, encType, fieldInfos] : recordInfos)
     {
         std::vector<uint8_t> tlvs;
@@ -323,14 +640,15 @@ void FruImpl::populateRecords(
 
         if (tlvs.size())
         {
-            if (numRecs == numRecsCount)
+            if (!recordSet.rsi)
             {
-                recordSetIdentifier = nextRSI();
+                recordSet.rsi = nextRSI();
                 bmc_record_handle = nextRecordHandle();
                 int rc = pldm_pdr_add_fru_record_set_check(
-                    pdrRepo, TERMINUS_HANDLE, recordSetIdentifier,
+                    pdrRepo, TERMINUS_HANDLE, recordSet.rsi,
                     entity.entity_type, entity.entity_instance_num,
                     entity.entity_container_id, &bmc_record_handle);
+                pldm::utils::pdrRepoChanged(pdrRepo);
                 if (rc)
                 {
                     // pldm_pdr_add_fru_record_set() assert()ed on failure
@@ -338,56 +656,56 @@ void FruImpl::populateRecords(
                         "Failed to add PDR FRU record set");
                 }
             }
-            auto curSize = table.size();
-            table.resize(curSize + recHeaderSize + tlvs.size());
-            encode_fru_record(table.data(), table.size(), &curSize,
-                              recordSetIdentifier, recType, numFRUFields,
-                              encType, tlvs.data(), tlvs.size());
-            numRecs++;
+            auto& records = recordSet.records;
+            auto curSize = records.size();
+            records.resize(curSize + recHeaderSize + tlvs.size());
+            encode_fru_record(records.data(), records.size(), &curSize,
+                              recordSet.rsi, recType, numFRUFields, encType,
+                              tlvs.data(), tlvs.size());
+            recordSet.numRecords++;
         }
     }
 }
 
-std::vector<uint8_t> FruImpl::tableResize()
+int FruImpl::getFRUTablePart(uint32_t transferHandle, uint8_t transferOpFlag,
+                             Part& part)
 {
-    std::vector<uint8_t> tempTable;
-
-    if (table.size())
+    size_t offset = 0;
+    if (transferOpFlag == PLDM_GET_FIRSTPART)
     {
-        std::copy(table.begin(), table.end(), std::back_inserter(tempTable));
-        padBytes = pldm::utils::getNumPadBytes(table.size());
-        tempTable.resize(tempTable.size() + padBytes, 0);
+        transferGeneration = generation;
     }
-    return tempTable;
-}
-
-void FruImpl::getFRUTable(Response& response)
-{
-    auto hdrSize = response.size();
-    std::vector<uint8_t> tempTable;
-
-    if (table.size())
+    else if (transferOpFlag == PLDM_GET_NEXTPART)
     {
-        tempTable = tableResize();
-        checksum = crc32(tempTable.data(), tempTable.size());
+        // A table updated in the middle of a transfer fails the transfer
+        if (transferGeneration != generation || transferHandle == 0 ||
+            transferHandle >= table.size())
+        {
+            return PLDM_FRU_INVALID_DATA_TRANSFER_HANDLE;
+        }
+        offset = transferHandle;
+    }
+    else
+    {
+        return invalidTransferOperationFlag;
     }
-    response.resize(hdrSize + tempTable.size() + sizeof(checksum), 0);
-    std::copy(tempTable.begin(), tempTable.end(), response.begin() + hdrSize);
-
-    // Copy the checksum to response data
-    auto iter = response.begin() + hdrSize + tempTable.size();
-    std::copy_n(reinterpret_cast<const uint8_t*>(&checksum), sizeof(checksum),
-                iter);
-}
 
-void FruImpl::getFRURecordTableMetadata()
-{
-    std::vector<uint8_t> tempTable;
-    if (table.size())
+    constexpr size_t maxPartSize =
+        FRU_TABLE_MAX_TRANSFER_SIZE ? FRU_TABLE_MAX_TRANSFER_SIZE : SIZE_MAX;
+    part.data = table.data() + offset;
+    part.length = std::min(table.size() - offset, maxPartSize);
+    bool last = offset + part.length == table.size();
+    if (offset == 0)
+    {
+        part.transferFlag = last ? PLDM_START_AND_END : PLDM_START;
+    }
+    else
     {
-        tempTable = tableResize();
-        checksum = crc32(tempTable.data(), tempTable.size());
+        part.transferFlag = last ? PLDM_END : PLDM_MIDDLE;
     }
+    part.nextTransferHandle = last ? 0 : offset + part.length;
+
+    return PLDM_SUCCESS;
 }
 
 int FruImpl::getFRURecordByOption(std::vector<uint8_t>& fruData,
@@ -400,16 +718,31 @@ int FruImpl::getFRURecordByOption(std::vector<uint8_t>& fruData,
     // FRU table is built lazily, build if not done.
     buildFRUTable();
 
+    // Only the records of the record set are filtered when it is given
+    const uint8_t* records = table.data();
+    size_t recordsSize = size();
+    if (recordSetIdentifer)
+    {
+        auto it = rsiToObj.find(recordSetIdentifer);
+        if (it == rsiToObj.end())
+        {
+            return PLDM_FRU_DATA_STRUCTURE_TABLE_UNAVAILABLE;
+        }
+        const auto& recordSet = fruRecordSets.at(it->second);
+        records = recordSet.records.data();
+        recordsSize = recordSet.records.size();
+    }
+
     /* 7 is sizeof(checksum,4) + padBytesMax(3)
      * We can not know size of the record table got by options in advance, but
-     * it must be less than the source table. So it's safe to use sizeof the
-     * source table + 7 as the buffer length
+     * it must be less than the source records. So it's safe to use sizeof the
+     * source records + 7 as the buffer length
      */
-    size_t recordTableSize = table.size() - padBytes + 7;
+    size_t recordTableSize = recordsSize + 7;
     fruData.resize(recordTableSize, 0);
 
     int rc = get_fru_record_by_option_check(
-        table.data(), table.size() - padBytes, fruData.data(), &recordTableSize,
+        records, recordsSize, fruData.data(), &recordTableSize,
         recordSetIdentifer, recordType, fieldType);
 
     if (rc != PLDM_SUCCESS || recordTableSize == 0)
@@ -418,11 +751,11 @@ int FruImpl::getFRURecordByOption(std::vector<uint8_t>& fruData,
     }
 
     auto pads = pldm::utils::getNumPadBytes(recordTableSize);
-    crc32(fruData.data(), recordTableSize + pads);
+    sum recordsChecksum = crc32(fruData.data(), recordTableSize + pads);
 
     auto iter = fruData.begin() + recordTableSize + pads;
-    std::copy_n(reinterpret_cast<const uint8_t*>(&checksum), sizeof(checksum),
-                iter);
+    std::copy_n(reinterpret_cast<const uint8_t*>(&recordsChecksum),
+                sizeof(recordsChecksum), iter);
     fruData.resize(recordTableSize + pads + sizeof(sum));
 
     return PLDM_SUCCESS;
@@ -463,8 +796,6 @@ Response Handler::getFRURecordTableMetadata(const pldm_msg* request,
                       0);
     auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
 
-    impl.getFRURecordTableMetadata();
-
     auto rc = encode_get_fru_record_table_metadata_resp(
         request->hdr.instance_id, PLDM_SUCCESS, major, minor, maxSize,
         impl.size(), impl.numRSI(), impl.numRecords(), impl.checkSum(),
@@ -488,19 +819,38 @@ Response Handler::getFRURecordTable(const pldm_msg* request,
         return ccOnlyResponse(request, PLDM_ERROR_INVALID_LENGTH);
     }
 
-    Response response(
-        sizeof(pldm_msg_hdr) + PLDM_GET_FRU_RECORD_TABLE_MIN_RESP_BYTES, 0);
+    uint32_t transferHandle{};
+    uint8_t transferOpFlag{};
+    auto rc = decode_get_fru_record_table_req(request, payloadLength,
+                                              &transferHandle, &transferOpFlag);
+    if (rc != PLDM_SUCCESS)
+    {
+        return ccOnlyResponse(request, rc);
+    }
+
+    FruImpl::Part part{};
+    rc = impl.getFRUTablePart(transferHandle, transferOpFlag, part);
+    if (rc != PLDM_SUCCESS)
+    {
+        return ccOnlyResponse(request, rc);
+    }
+
+    Response response(sizeof(pldm_msg_hdr) +
+                      PLDM_GET_FRU_RECORD_TABLE_MIN_RESP_BYTES + part.length);
     auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
 
-    auto rc = encode_get_fru_record_table_resp(request->hdr.instance_id,
-                                               PLDM_SUCCESS, 0,
-                                               PLDM_START_AND_END, responsePtr);
+    rc = encode_get_fru_record_table_resp(request->hdr.instance_id,
+                                          PLDM_SUCCESS, part.nextTransferHandle,
+                                          part.transferFlag, responsePtr);
     if (rc != PLDM_SUCCESS)
     {
         return ccOnlyResponse(request, rc);
     }
 
-    impl.getFRUTable(response);
+    // The part is copied straight from the table into the response
+    std::copy_n(part.data, part.length,
+                response.begin() + sizeof(pldm_msg_hdr) +
+                    PLDM_GET_FRU_RECORD_TABLE_MIN_RESP_BYTES);
 
     return response;
 }
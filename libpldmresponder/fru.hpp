@@ -8,9 +8,12 @@
 #include <libpldm/fru.h>
 #include <libpldm/pdr.h>
 
+#include <sdbusplus/bus/match.hpp>
 #include <sdbusplus/message.hpp>
 
 #include <map>
+#include <memory>
+#include <optional>
 #include <string>
 #include <variant>
 #include <vector>
@@ -73,17 +76,35 @@ class FruImpl
         oemFruHandler(oemFruHandler)
     {}
 
-    /** @brief Total length of the FRU table in bytes, this includes the pad
-     *         bytes and the checksum.
+    /** @brief DSP0257 INVALID_TRANSFER_OPERATION_FLAG, not defined by
+     *         libpldm
+     */
+    static constexpr uint8_t invalidTransferOperationFlag = 0x81;
+
+    /** @struct Part
+     *  @brief The part of the FRU table to send in a GetFRURecordTable
+     *         response
+     */
+    struct Part
+    {
+        const uint8_t* data;
+        size_t length;
+        uint32_t nextTransferHandle;
+        uint8_t transferFlag;
+    };
+
+    /** @brief Length of the FRU records in the FRU table in bytes, without
+     *         the pad bytes and the checksum.
      *
      *  @return size of the FRU table
      */
     uint32_t size() const
     {
-        return table.size();
+        return table.size() - padBytes - sizeof(checksum);
     }
 
-    /** @brief The checksum of the contents of the FRU table
+    /** @brief The checksum of the contents of the FRU table, updated with the
+     *         table
      *
      *  @return checksum
      */
@@ -98,7 +119,7 @@ class FruImpl
      */
     uint16_t numRSI() const
     {
-        return rsi;
+        return rsiToObj.size();
     }
 
     /** @brief The number of FRU records in the table
@@ -110,16 +131,22 @@ class FruImpl
         return numRecs;
     }
 
-    /** @brief Get the FRU table
+    /** @brief Get the part of the FRU table requested by a GetFRURecordTable
+     *         request
      *
-     *  @param[out] - Populate response with the FRU table
-     */
-    void getFRUTable(Response& response);
-
-    /** @brief Get the Fru Table MetaData
+     *  @details The FRU table is sent padded and followed by its checksum,
+     *  in parts of at most fru-table-max-transfer-size bytes, in a single
+     *  part if the option is 0. The transfer handle of a part is its offset
+     *  in the table.
      *
+     *  @param[in] transferHandle - transfer handle of the request
+     *  @param[in] transferOpFlag - transfer operation flag of the request
+     *  @param[out] part - the part to send, valid until the table changes
+     *
+     *  @return pldm_completion_codes
      */
-    void getFRURecordTableMetadata();
+    int getFRUTablePart(uint32_t transferHandle, uint8_t transferOpFlag,
+                        Part& part);
 
     /** @brief Get FRU Record Table By Option
      *  @param[out] response - Populate response with the FRU table got by
@@ -135,10 +162,47 @@ class FruImpl
 
     /** @brief FRU table is built by processing the D-Bus inventory namespace
      *         based on the config files for FRU. The table is populated based
-     *         on the isBuilt flag.
+     *         on the isBuilt flag, and then kept up to date from the
+     *         inventory signals.
      */
     void buildFRUTable();
 
+    /** @brief Build the FRU table from the inventory objects
+     *
+     *  @param[in] objects - inventory objects as returned by
+     *                       GetManagedObjects
+     */
+    void buildFRUTable(const dbus::ObjectValueTree& objects);
+
+    /** @brief Update the FRU table with the interfaces added to an inventory
+     *         object
+     *
+     *  @param[in] path - object path
+     *  @param[in] interfaces - interfaces added and their properties
+     */
+    void interfacesAdded(const dbus::ObjectPath& path,
+                         const dbus::InterfaceMap& interfaces);
+
+    /** @brief Update the FRU table with the interfaces removed from an
+     *         inventory object
+     *
+     *  @param[in] path - object path
+     *  @param[in] interfaces - interfaces removed
+     */
+    void interfacesRemoved(const dbus::ObjectPath& path,
+                           const std::vector<std::string>& interfaces);
+
+    /** @brief Update the FRU table with the changed properties of an
+     *         inventory object
+     *
+     *  @param[in] path - object path
+     *  @param[in] interface - interface of the properties
+     *  @param[in] properties - changed properties
+     */
+    void propertiesChanged(const dbus::ObjectPath& path,
+                           const dbus::Interface& interface,
+                           const dbus::PropertyMap& properties);
+
     /** @brief Get std::map associated with the entity
      *         key: object path
      *         value: pldm_entity
@@ -181,18 +245,13 @@ class FruImpl
     void updateAssociationTree(const dbus::ObjectValueTree& objects,
                                const std::string& path);
 
-    /* @brief Method to populate the firmware version ID
+    /* @brief Method to populate the firmware version ID, the version is
+     *        looked up once and then cached
      *
      * @return firmware version ID
      */
     std::string populatefwVersion();
 
-    /* @brief Method to resize the table
-     *
-     * @return resized table
-     */
-    std::vector<uint8_t> tableResize();
-
     /* @brief set FRU Record Table
      *
      * @param[in] fruData - the data of the fru
@@ -202,6 +261,20 @@ class FruImpl
     int setFRUTable(const std::vector<uint8_t>& fruData);
 
   private:
+    /** @struct FruRecordSet
+     *
+     *  The FRU records of a present FRU, kept to update the FRU table in place
+     */
+    struct FruRecordSet
+    {
+        std::string itemInterface;   //!< item interface from FRU_Master.json
+        pldm_entity entity{};        //!< entity of the FRU
+        uint16_t rsi = 0;            //!< record set identifier, 0 until the
+                                     //!< FRU has a record
+        uint16_t numRecords = 0;     //!< number of FRU records
+        std::vector<uint8_t> records; //!< encoded FRU records
+    };
+
     uint16_t nextRSI()
     {
         return ++rsi;
@@ -216,8 +289,13 @@ class FruImpl
     uint16_t rsi = 0;
     uint16_t numRecs = 0;
     uint8_t padBytes = 0;
-    std::vector<uint8_t> table;
+    /** @brief FRU records, pad bytes and checksum, as sent */
+    std::vector<uint8_t> table = std::vector<uint8_t>(sizeof(uint32_t), 0);
     uint32_t checksum = 0;
+    /** @brief Incremented on each change of the table */
+    uint32_t generation = 0;
+    /** @brief Generation of the table the transfer in progress started on */
+    uint32_t transferGeneration = 0;
     bool isBuilt = false;
 
     fru_parser::FruParser parser;
@@ -228,17 +306,65 @@ class FruImpl
 
     std::map<dbus::ObjectPath, pldm_entity_node*> objToEntityNode{};
 
-    /** @brief populateRecord builds the FRU records for an instance of FRU and
-     *         updates the FRU table with the FRU records.
+    /** @brief Inventory objects, from GetManagedObjects and then the
+     *         inventory signals
+     */
+    dbus::ObjectValueTree inventory;
+    /** @brief Item interfaces of the FRUs from FRU_Master.json */
+    dbus::Interfaces itemInterfaces;
+    /** @brief FRU records of the present FRUs */
+    std::map<dbus::ObjectPath, FruRecordSet> fruRecordSets;
+    /** @brief Object path of each record set, in FRU table order */
+    std::map<uint16_t, dbus::ObjectPath> rsiToObj;
+    /** @brief Matches on the inventory signals */
+    std::vector<std::unique_ptr<sdbusplus::bus::match_t>> inventoryMatches;
+    /** @brief Running BMC firmware version, once looked up */
+    std::optional<std::string> bmcVersion;
+
+    /** @brief Subscribe to the signals of the inventory objects
+     *
+     *  @param[in] dbusInfo - inventory service and object manager path
+     */
+    void subscribeInventory(const fru_parser::DBusLookupInfo& dbusInfo);
+
+    /** @brief Add, update or remove the FRU records of an inventory object
+     *         after a change of the object
+     *
+     *  @param[in] path - object path
+     */
+    void updateFru(const dbus::ObjectPath& path);
+
+    /** @brief Add the FRU records of a present FRU
+     *
+     *  @param[in] path - object path
+     *  @param[in] itemInterface - item interface of the FRU
+     */
+    void addFru(const dbus::ObjectPath& path,
+                const dbus::Interface& itemInterface);
+
+    /** @brief Remove the FRU records and the record set PDR of a FRU
+     *
+     *  @param[in] path - object path
+     */
+    void removeFru(const dbus::ObjectPath& path);
+
+    /** @brief Rebuild the FRU table from the FRU records of each FRU, with
+     *         its pad bytes and checksum
+     */
+    void updateTable();
+
+    /** @brief populateRecord builds the FRU records for an instance of FRU,
+     *         the record set PDR is added with the first record.
      *
      *  @param[in] interfaces - D-Bus interfaces and the associated property
      *                          values for the FRU
      *  @param[in] recordInfos - FRU record info to build the FRU records
-     *  @param[in/out] entity - PLDM entity corresponding to FRU instance
+     *  @param[in/out] recordSet - FRU record set, with the PLDM entity
+     *                             corresponding to FRU instance
      */
     void populateRecords(const dbus::InterfaceMap& interfaces,
                          const fru_parser::FruRecordInfos& recordInfos,
-                         const pldm_entity& entity);
+                         FruRecordSet& recordSet);
 
     /** @brief Associate sensor/effecter to FRU entity
      */
@@ -714,6 +714,7 @@ int Handler::pldmPDRRepositoryChgEvent(const pldm_msg* request,
                 {
                     pldm_pdr_remove_pdrs_by_terminus_handle(pdrRepo.getPdr(),
                                                             it->first);
+                    pldm::utils::pdrRepoChanged(pdrRepo.getPdr());
                     hostPDRHandler->tlPDRInfo.erase(it++);
                 }
                 else
@@ -947,68 +948,41 @@ bool isOemStateSensor(Handler& handler, uint16_t sensorId,
                       uint16_t& entityType, uint16_t& entityInstance,
                       uint16_t& stateSetId)
 {
-    pldm_state_sensor_pdr* pdr = nullptr;
-
-    std::unique_ptr<pldm_pdr, decltype(&pldm_pdr_destroy)> stateSensorPdrRepo(
-        pldm_pdr_init(), pldm_pdr_destroy);
-    if (!stateSensorPdrRepo)
+    auto pdr = handler.getPDRIndex().getStateSensorPDR(sensorId);
+    if (!pdr)
     {
-        error("Failed to instantiate state sensor PDR repository");
         return false;
     }
-    Repo stateSensorPDRs(stateSensorPdrRepo.get());
-    getRepoByType(handler.getRepo(), stateSensorPDRs, PLDM_STATE_SENSOR_PDR);
-    if (stateSensorPDRs.empty())
+
+    auto tmpEntityType = pdr->entity_type;
+    auto tmpEntityInstance = pdr->entity_instance;
+    auto tmpCompSensorCnt = pdr->composite_sensor_count;
+    auto tmpPossibleStates =
+        reinterpret_cast<const state_sensor_possible_states*>(
+            pdr->possible_states);
+    auto tmpStateSetId = tmpPossibleStates->state_set_id;
+
+    if (sensorRearmCount > tmpCompSensorCnt)
     {
-        error("Failed to get record by PDR type");
+        error(
+            "The requester sent wrong sensorRearm count for the sensor, SENSOR_ID={SENSOR_ID} SENSOR_REARM_COUNT={SENSOR_REARM_CNT}",
+            "SENSOR_ID", sensorId, "SENSOR_REARM_CNT",
+            (uint16_t)sensorRearmCount);
         return false;
     }
 
-    PdrEntry pdrEntry{};
-    auto pdrRecord = stateSensorPDRs.getFirstRecord(pdrEntry);
-    while (pdrRecord)
+    if ((tmpEntityType >= PLDM_OEM_ENTITY_TYPE_START &&
+         tmpEntityType <= PLDM_OEM_ENTITY_TYPE_END) ||
+        (tmpStateSetId >= PLDM_OEM_STATE_SET_ID_START &&
+         tmpStateSetId < PLDM_OEM_STATE_SET_ID_END))
     {
-        pdr = reinterpret_cast<pldm_state_sensor_pdr*>(pdrEntry.data);
-        assert(pdr != NULL);
-        if (pdr->sensor_id != sensorId)
-        {
-            pdr = nullptr;
-            pdrRecord = stateSensorPDRs.getNextRecord(pdrRecord, pdrEntry);
-            continue;
-        }
-        auto tmpEntityType = pdr->entity_type;
-        auto tmpEntityInstance = pdr->entity_instance;
-        auto tmpCompSensorCnt = pdr->composite_sensor_count;
-        auto tmpPossibleStates =
-            reinterpret_cast<state_sensor_possible_states*>(
-                pdr->possible_states);
-        auto tmpStateSetId = tmpPossibleStates->state_set_id;
-
-        if (sensorRearmCount > tmpCompSensorCnt)
-        {
-            error(
-                "The requester sent wrong sensorRearm count for the sensor, SENSOR_ID={SENSOR_ID} SENSOR_REARM_COUNT={SENSOR_REARM_CNT}",
-                "SENSOR_ID", sensorId, "SENSOR_REARM_CNT",
-                (uint16_t)sensorRearmCount);
-            break;
-        }
-
-        if ((tmpEntityType >= PLDM_OEM_ENTITY_TYPE_START &&
-             tmpEntityType <= PLDM_OEM_ENTITY_TYPE_END) ||
-            (tmpStateSetId >= PLDM_OEM_STATE_SET_ID_START &&
-             tmpStateSetId < PLDM_OEM_STATE_SET_ID_END))
-        {
-            entityType = tmpEntityType;
-            entityInstance = tmpEntityInstance;
-            stateSetId = tmpStateSetId;
-            compSensorCnt = tmpCompSensorCnt;
-            return true;
-        }
-        else
-        {
-            return false;
-        }
+        entityType = tmpEntityType;
+        entityInstance = tmpEntityInstance;
+        stateSetId = tmpStateSetId;
+        compSensorCnt = tmpCompSensorCnt;
+        return true;
     }
+
     return false;
 }
 
@@ -1016,68 +990,39 @@ bool isOemStateEffecter(Handler& handler, uint16_t effecterId,
                         uint8_t compEffecterCnt, uint16_t& entityType,
                         uint16_t& entityInstance, uint16_t& stateSetId)
 {
-    pldm_state_effecter_pdr* pdr = nullptr;
-
-    std::unique_ptr<pldm_pdr, decltype(&pldm_pdr_destroy)> stateEffecterPdrRepo(
-        pldm_pdr_init(), pldm_pdr_destroy);
-    if (!stateEffecterPdrRepo)
+    auto pdr = handler.getPDRIndex().getStateEffecterPDR(effecterId);
+    if (!pdr)
     {
-        error("Failed to instantiate state effecter PDR repository");
         return false;
     }
-    Repo stateEffecterPDRs(stateEffecterPdrRepo.get());
-    getRepoByType(handler.getRepo(), stateEffecterPDRs,
-                  PLDM_STATE_EFFECTER_PDR);
-    if (stateEffecterPDRs.empty())
+
+    auto tmpEntityType = pdr->entity_type;
+    auto tmpEntityInstance = pdr->entity_instance;
+    auto tmpPossibleStates =
+        reinterpret_cast<const state_effecter_possible_states*>(
+            pdr->possible_states);
+    auto tmpStateSetId = tmpPossibleStates->state_set_id;
+
+    if (compEffecterCnt > pdr->composite_effecter_count)
     {
-        error("Failed to get record by PDR type");
+        error(
+            "The requester sent wrong composite effecter count for the effecter, EFFECTER_ID={EFFECTER_ID} COMP_EFF_CNT={COMP_EFF_CNT}",
+            "EFFECTER_ID", effecterId, "COMP_EFF_CNT",
+            (uint16_t)compEffecterCnt);
         return false;
     }
 
-    PdrEntry pdrEntry{};
-    auto pdrRecord = stateEffecterPDRs.getFirstRecord(pdrEntry);
-    while (pdrRecord)
+    if ((tmpEntityType >= PLDM_OEM_ENTITY_TYPE_START &&
+         tmpEntityType <= PLDM_OEM_ENTITY_TYPE_END) ||
+        (tmpStateSetId >= PLDM_OEM_STATE_SET_ID_START &&
+         tmpStateSetId < PLDM_OEM_STATE_SET_ID_END))
     {
-        pdr = reinterpret_cast<pldm_state_effecter_pdr*>(pdrEntry.data);
-        assert(pdr != NULL);
-        if (pdr->effecter_id != effecterId)
-        {
-            pdr = nullptr;
-            pdrRecord = stateEffecterPDRs.getNextRecord(pdrRecord, pdrEntry);
-            continue;
-        }
-
-        auto tmpEntityType = pdr->entity_type;
-        auto tmpEntityInstance = pdr->entity_instance;
-        auto tmpPossibleStates =
-            reinterpret_cast<state_effecter_possible_states*>(
-                pdr->possible_states);
-        auto tmpStateSetId = tmpPossibleStates->state_set_id;
-
-        if (compEffecterCnt > pdr->composite_effecter_count)
-        {
-            error(
-                "The requester sent wrong composite effecter count for the effecter, EFFECTER_ID={EFFECTER_ID} COMP_EFF_CNT={COMP_EFF_CNT}",
-                "EFFECTER_ID", effecterId, "COMP_EFF_CNT",
-                (uint16_t)compEffecterCnt);
-            return false;
-        }
-
-        if ((tmpEntityType >= PLDM_OEM_ENTITY_TYPE_START &&
-             tmpEntityType <= PLDM_OEM_ENTITY_TYPE_END) ||
-            (tmpStateSetId >= PLDM_OEM_STATE_SET_ID_START &&
-             tmpStateSetId < PLDM_OEM_STATE_SET_ID_END))
-        {
-            entityType = tmpEntityType;
-            entityInstance = tmpEntityInstance;
-            stateSetId = tmpStateSetId;
-            return true;
-        }
-        else
-        {
-            return false;
-        }
+        entityType = tmpEntityType;
+        entityInstance = tmpEntityInstance;
+        stateSetId = tmpStateSetId;
+        return true;
     }
+
     return false;
 }
 
@@ -60,7 +60,7 @@ class Handler : public CmdHandler
             sdeventplus::Event& event, bool buildPDRLazily = false,
             const std::optional<EventMap>& addOnHandlersMap = std::nullopt) :
         eid(eid),
-        instanceIdDb(instanceIdDb), pdrRepo(repo),
+        instanceIdDb(instanceIdDb), pdrRepo(repo), pdrIndex(repo),
         hostPDRHandler(hostPDRHandler),
         dbusToPLDMEventHandler(dbusToPLDMEventHandler), fruHandler(fruHandler),
         dBusIntf(dBusIntf), oemPlatformHandler(oemPlatformHandler),
@@ -156,6 +156,12 @@ class Handler : public CmdHandler
         return this->pdrRepo;
     }
 
+    /** @brief Get the sensor and effecter index of the PDR repo */
+    pldm::utils::PDRIndex& getPDRIndex()
+    {
+        return this->pdrIndex;
+    }
+
     /** @brief Add D-Bus mapping and value mapping(stateId to D-Bus) for the
      *         Id. If the same id is added, the previous dbusObjs will
      *         be "over-written".
@@ -345,55 +351,24 @@ class Handler : public CmdHandler
         using namespace pldm::utils;
         using StateSetNum = uint8_t;
 
-        state_effecter_possible_states* states = nullptr;
-        pldm_state_effecter_pdr* pdr = nullptr;
+        const state_effecter_possible_states* states = nullptr;
         uint8_t compEffecterCnt = stateField.size();
 
-        std::unique_ptr<pldm_pdr, decltype(&pldm_pdr_destroy)>
-            stateEffecterPdrRepo(pldm_pdr_init(), pldm_pdr_destroy);
-        if (!stateEffecterPdrRepo)
-        {
-            throw std::runtime_error(
-                "Failed to instantiate state effecter PDR repository");
-        }
-        pldm::responder::pdr_utils::Repo stateEffecterPDRs(
-            stateEffecterPdrRepo.get());
-        getRepoByType(pdrRepo, stateEffecterPDRs, PLDM_STATE_EFFECTER_PDR);
-        if (stateEffecterPDRs.empty())
+        auto pdr = pdrIndex.getStateEffecterPDR(effecterId);
+        if (!pdr)
         {
-            error("Failed to get record by PDR type");
             return PLDM_PLATFORM_INVALID_EFFECTER_ID;
         }
 
-        pldm::responder::pdr_utils::PdrEntry pdrEntry{};
-        auto pdrRecord = stateEffecterPDRs.getFirstRecord(pdrEntry);
-        while (pdrRecord)
+        states = reinterpret_cast<const state_effecter_possible_states*>(
+            pdr->possible_states);
+        if (compEffecterCnt > pdr->composite_effecter_count)
         {
-            pdr = reinterpret_cast<pldm_state_effecter_pdr*>(pdrEntry.data);
-            if (pdr->effecter_id != effecterId)
-            {
-                pdr = nullptr;
-                pdrRecord = stateEffecterPDRs.getNextRecord(pdrRecord,
-                                                            pdrEntry);
-                continue;
-            }
-
-            states = reinterpret_cast<state_effecter_possible_states*>(
-                pdr->possible_states);
-            if (compEffecterCnt > pdr->composite_effecter_count)
-            {
-                error(
-                    "The requester sent wrong composite effecter count for the effecter, EFFECTER_ID={EFFECTER_ID} COMP_EFF_CNT={COMP_EFF_CNT}",
-                    "EFFECTER_ID", (unsigned)effecterId, "COMP_EFF_CNT",
-                    (unsigned)compEffecterCnt);
-                return PLDM_ERROR_INVALID_DATA;
-            }
-            break;
-        }
-
-        if (!pdr)
-        {
-            return PLDM_PLATFORM_INVALID_EFFECTER_ID;
+            error(
+                "The requester sent wrong composite effecter count for the effecter, EFFECTER_ID={EFFECTER_ID} COMP_EFF_CNT={COMP_EFF_CNT}",
+                "EFFECTER_ID", (unsigned)effecterId, "COMP_EFF_CNT",
+                (unsigned)compEffecterCnt);
+            return PLDM_ERROR_INVALID_DATA;
         }
 
         int rc = PLDM_SUCCESS;
@@ -446,13 +421,14 @@ class Handler : public CmdHandler
                         return PLDM_ERROR;
                     }
                 }
-                uint8_t* nextState =
-                    reinterpret_cast<uint8_t*>(states) +
+                const uint8_t* nextState =
+                    reinterpret_cast<const uint8_t*>(states) +
                     sizeof(state_effecter_possible_states) -
                     sizeof(states->states) +
                     (states->possible_states_size * sizeof(states->states));
-                states = reinterpret_cast<state_effecter_possible_states*>(
-                    nextState);
+                states =
+                    reinterpret_cast<const state_effecter_possible_states*>(
+                        nextState);
             }
         }
         catch (const std::out_of_range& e)
@@ -499,6 +475,7 @@ class Handler : public CmdHandler
     uint8_t eid;
     InstanceIdDb* instanceIdDb;
     pdr_utils::Repo pdrRepo;
+    pldm::utils::PDRIndex pdrIndex;
     uint16_t nextEffecterId{};
     uint16_t nextSensorId{};
     DbusObjMaps effecterDbusObjMaps{};
@@ -43,54 +43,23 @@ int setStateEffecterStatesHandler(
     using namespace pldm::utils;
     using StateSetNum = uint8_t;
 
-    state_effecter_possible_states* states = nullptr;
-    pldm_state_effecter_pdr* pdr = nullptr;
+    const state_effecter_possible_states* states = nullptr;
     uint8_t compEffecterCnt = stateField.size();
 
-    std::unique_ptr<pldm_pdr, decltype(&pldm_pdr_destroy)> stateEffecterPdrRepo(
-        pldm_pdr_init(), pldm_pdr_destroy);
-    if (!stateEffecterPdrRepo)
-    {
-        throw std::runtime_error(
-            "Failed to instantiate state effecter PDR repository");
-    }
-    pldm::responder::pdr_utils::Repo stateEffecterPDRs(
-        stateEffecterPdrRepo.get());
-    getRepoByType(handler.getRepo(), stateEffecterPDRs,
-                  PLDM_STATE_EFFECTER_PDR);
-    if (stateEffecterPDRs.empty())
+    auto pdr = handler.getPDRIndex().getStateEffecterPDR(effecterId);
+    if (!pdr)
     {
-        error("Failed to get record by PDR type");
         return PLDM_PLATFORM_INVALID_EFFECTER_ID;
     }
 
-    pldm::responder::pdr_utils::PdrEntry pdrEntry{};
-    auto pdrRecord = stateEffecterPDRs.getFirstRecord(pdrEntry);
-    while (pdrRecord)
+    states = reinterpret_cast<const state_effecter_possible_states*>(
+        pdr->possible_states);
+    if (compEffecterCnt > pdr->composite_effecter_count)
     {
-        pdr = reinterpret_cast<pldm_state_effecter_pdr*>(pdrEntry.data);
-        if (pdr->effecter_id != effecterId)
-        {
-            pdr = nullptr;
-            pdrRecord = stateEffecterPDRs.getNextRecord(pdrRecord, pdrEntry);
-            continue;
-        }
-
-        states = reinterpret_cast<state_effecter_possible_states*>(
-            pdr->possible_states);
-        if (compEffecterCnt > pdr->composite_effecter_count)
-        {
-            error(
-                "The requester sent wrong composite effecter count for the effecter, EFFECTER_ID={EFFECTER_ID} COMP_EFF_CNT={COMP_EFF_CNT}",
-                "EFFECTER_ID", effecterId, "COMP_EFF_CNT", compEffecterCnt);
-            return PLDM_ERROR_INVALID_DATA;
-        }
-        break;
-    }
-
-    if (!pdr)
-    {
-        return PLDM_PLATFORM_INVALID_EFFECTER_ID;
+        error(
+            "The requester sent wrong composite effecter count for the effecter, EFFECTER_ID={EFFECTER_ID} COMP_EFF_CNT={COMP_EFF_CNT}",
+            "EFFECTER_ID", effecterId, "COMP_EFF_CNT", compEffecterCnt);
+        return PLDM_ERROR_INVALID_DATA;
     }
 
     int rc = PLDM_SUCCESS;
@@ -140,13 +109,13 @@ int setStateEffecterStatesHandler(
                     return PLDM_ERROR;
                 }
             }
-            uint8_t* nextState =
-                reinterpret_cast<uint8_t*>(states) +
+            const uint8_t* nextState =
+                reinterpret_cast<const uint8_t*>(states) +
                 sizeof(state_effecter_possible_states) -
                 sizeof(states->states) +
                 (states->possible_states_size * sizeof(states->states));
-            states =
-                reinterpret_cast<state_effecter_possible_states*>(nextState);
+            states = reinterpret_cast<const state_effecter_possible_states*>(
+                nextState);
         }
     }
     catch (const std::out_of_range& e)
@@ -8,6 +8,7 @@
 
 #include <nlohmann/json.hpp>
 
+#include <chrono>
 #include <fstream>
 #include <memory>
 
@@ -407,3 +408,110 @@ TEST_F(TestBIOSConfig, setAttrValue)
     EXPECT_THAT(std::vector<uint8_t>(p, p + attrValueEntry.size()),
                 ElementsAreArray(attrValueEntry));
 }
+
+TEST_F(TestBIOSConfig, persistTablesOnFlush)
+{
+    MockdBusHandler dbusHandler;
+    MockSystemConfig mockSystemConfig;
+
+    EXPECT_CALL(mockSystemConfig, getPlatformName())
+        .Times(2)
+        .WillRepeatedly(Return(""));
+    ON_CALL(dbusHandler, getDbusPropertyVariant(_, _, _))
+        .WillByDefault(Throw(std::exception()));
+
+    std::optional<Table> stringTable;
+    std::optional<Table> attrTable;
+    std::optional<Table> attrValueTable;
+    {
+        BIOSConfig biosConfig("./bios_jsons", tableDir.c_str(), &dbusHandler,
+                              0, 0, nullptr, nullptr, &mockSystemConfig);
+        biosConfig.removeTables();
+        biosConfig.buildTables();
+        EXPECT_EQ(biosConfig.getTableWrites(), 0);
+        EXPECT_FALSE(fs::exists(tableDir / "stringTable"));
+
+        biosConfig.syncTables();
+        EXPECT_EQ(biosConfig.getTableWrites(), 3);
+        biosConfig.syncTables();
+        EXPECT_EQ(biosConfig.getTableWrites(), 3);
+
+        stringTable = *biosConfig.getBIOSTable(PLDM_BIOS_STRING_TABLE);
+        attrTable = *biosConfig.getBIOSTable(PLDM_BIOS_ATTR_TABLE);
+        attrValueTable = *biosConfig.getBIOSTable(PLDM_BIOS_ATTR_VAL_TABLE);
+    }
+
+    BIOSConfig biosConfig("./bios_jsons", tableDir.c_str(), &dbusHandler, 0, 0,
+                          nullptr, nullptr, &mockSystemConfig);
+    ASSERT_TRUE(biosConfig.getBIOSTable(PLDM_BIOS_STRING_TABLE));
+    ASSERT_TRUE(biosConfig.getBIOSTable(PLDM_BIOS_ATTR_TABLE));
+    ASSERT_TRUE(biosConfig.getBIOSTable(PLDM_BIOS_ATTR_VAL_TABLE));
+    EXPECT_EQ(*biosConfig.getBIOSTable(PLDM_BIOS_STRING_TABLE), stringTable);
+    EXPECT_EQ(*biosConfig.getBIOSTable(PLDM_BIOS_ATTR_TABLE), attrTable);
+    EXPECT_EQ(*biosConfig.getBIOSTable(PLDM_BIOS_ATTR_VAL_TABLE),
+              attrValueTable);
+}
+
+TEST_F(TestBIOSConfig, attrValueChangesAreWrittenBehind)
+{
+    MockdBusHandler dbusHandler;
+    MockSystemConfig mockSystemConfig;
+
+    EXPECT_CALL(mockSystemConfig, getPlatformName()).WillOnce(Return(""));
+    BIOSConfig biosConfig("./bios_jsons", tableDir.c_str(), &dbusHandler, 0, 0,
+                          nullptr, nullptr, &mockSystemConfig);
+    biosConfig.removeTables();
+    biosConfig.buildTables();
+    biosConfig.syncTables();
+    auto writes = biosConfig.getTableWrites();
+
+    auto stringTable = biosConfig.getBIOSTable(PLDM_BIOS_STRING_TABLE);
+    auto attrTable = biosConfig.getBIOSTable(PLDM_BIOS_ATTR_TABLE);
+    BIOSStringTable biosStringTable(*stringTable);
+    auto stringHandle = biosStringTable.findHandle("str_example1");
+    uint16_t attrHandle{};
+    for (auto entry : BIOSTableIter<PLDM_BIOS_ATTR_TABLE>(attrTable->data(),
+                                                          attrTable->size()))
+    {
+        auto header = table::attribute::decodeHeader(entry);
+        if (header.stringHandle == stringHandle)
+        {
+            attrHandle = header.attrHandle;
+            break;
+        }
+    }
+    EXPECT_NE(attrHandle, 0);
+
+    std::vector<uint8_t> attrValueEntry{
+        static_cast<uint8_t>(attrHandle & 0xff),
+        static_cast<uint8_t>((attrHandle >> 8) & 0xff),
+        1,                  /* attr type string read-write */
+        4,   0,             /* current string length */
+        'a', 'b', 'c', 'd', /* current string */
+    };
+
+    constexpr size_t changes = 1000;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < changes; i++)
+    {
+        attrValueEntry.back() = 'a' + i % 26;
+        auto rc = biosConfig.setAttrValue(
+            attrValueEntry.data(), attrValueEntry.size(), true, false, false);
+        EXPECT_EQ(rc, PLDM_SUCCESS);
+    }
+    biosConfig.syncTables();
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    /* All the changes are persisted with a single write */
+    EXPECT_EQ(biosConfig.getTableWrites() - writes, 1);
+    RecordProperty("wall_time_us", std::to_string(elapsed.count()));
+    RecordProperty("fsyncs",
+                   std::to_string(biosConfig.getTableWrites() - writes));
+
+    BIOSTable persisted((tableDir / "attributeValueTable").c_str());
+    Table persistedTable;
+    persisted.load(persistedTable);
+    EXPECT_EQ(persistedTable,
+              *biosConfig.getBIOSTable(PLDM_BIOS_ATTR_VAL_TABLE));
+}
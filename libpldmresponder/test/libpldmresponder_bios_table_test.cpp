@@ -3,6 +3,8 @@
 #include <stdlib.h>
 
 #include <algorithm>
+#include <chrono>
+#include <string>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -59,3 +61,237 @@ TEST_F(TestBIOSTable, testLoadOntoExisting)
     ASSERT_EQ(out[0], 99);
     ASSERT_EQ(out[1], 99);
 }
+
+TEST_F(TestBIOSTable, writerKeepsLatestTable)
+{
+    fs::path file(dir / "t1");
+    {
+        BIOSTableWriter writer;
+        writer.submit(file, {1, 2, 3, 4});
+        writer.submit(file, {5, 6, 7, 8});
+        writer.wait();
+        EXPECT_GE(writer.getWrites(), 1);
+
+        std::vector<uint8_t> out{};
+        BIOSTable(file.string().c_str()).load(out);
+        EXPECT_EQ(out, (std::vector<uint8_t>{5, 6, 7, 8}));
+
+        /* Queued tables are written before the writer stops */
+        writer.submit(file, {9, 10, 11, 12});
+    }
+    std::vector<uint8_t> out{};
+    BIOSTable(file.string().c_str()).load(out);
+    EXPECT_EQ(out, (std::vector<uint8_t>{9, 10, 11, 12}));
+}
+
+TEST(BIOSTableIndex, lookupsAtTenThousandAttributes)
+{
+    constexpr size_t count = 10000;
+    Table stringTable;
+    std::vector<uint16_t> stringHandles;
+    for (size_t i = 0; i < count; i++)
+    {
+        auto entry = table::string::constructEntry(stringTable,
+                                                   "attr_" + std::to_string(i));
+        stringHandles.emplace_back(table::string::decodeHandle(entry));
+    }
+    table::appendPadAndChecksum(stringTable);
+
+    Table attrTable;
+    std::vector<uint16_t> attrHandles;
+    for (size_t i = 0; i < count; i++)
+    {
+        pldm_bios_table_attr_entry_integer_info info{
+            stringHandles[i], false, 0, 100, 1, 0};
+        auto entry = table::attribute::constructIntegerEntry(attrTable, &info);
+        attrHandles.emplace_back(
+            table::attribute::decodeHeader(entry).attrHandle);
+    }
+    table::appendPadAndChecksum(attrTable);
+
+    auto start = std::chrono::steady_clock::now();
+    BIOSStringTable biosStringTable(stringTable);
+    BIOSAttrTableIndex attrIndex(attrTable);
+    auto built = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        auto handle = biosStringTable.findHandle("attr_" + std::to_string(i));
+        ASSERT_EQ(handle, stringHandles[i]);
+        ASSERT_EQ(biosStringTable.findString(handle),
+                  "attr_" + std::to_string(i));
+        auto entry = attrIndex.findByStringHandle(attrTable, handle);
+        ASSERT_NE(entry, nullptr);
+        ASSERT_EQ(table::attribute::decodeHeader(entry).attrHandle,
+                  attrHandles[i]);
+        ASSERT_EQ(attrIndex.findByHandle(attrTable, attrHandles[i]), entry);
+    }
+    auto indexed = std::chrono::steady_clock::now();
+
+    /* The same name to attribute resolution through table scans, sampled */
+    constexpr size_t samples = 100;
+    for (size_t i = 0; i < count; i += count / samples)
+    {
+        auto name = "attr_" + std::to_string(i);
+        auto stringEntry = pldm_bios_table_string_find_by_string(
+            stringTable.data(), stringTable.size(), name.c_str());
+        ASSERT_NE(stringEntry, nullptr);
+        auto entry = table::attribute::findByStringHandle(
+            attrTable, table::string::decodeHandle(stringEntry));
+        ASSERT_NE(entry, nullptr);
+    }
+    auto scanned = std::chrono::steady_clock::now();
+
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+    auto indexedNs = duration_cast<nanoseconds>(indexed - built).count() /
+                     count;
+    auto scannedNs = duration_cast<nanoseconds>(scanned - indexed).count() /
+                     samples;
+    RecordProperty("index_build_us",
+                   std::to_string(duration_cast<std::chrono::microseconds>(
+                                      built - start)
+                                      .count()));
+    RecordProperty("indexed_lookup_ns", std::to_string(indexedNs));
+    RecordProperty("scanned_lookup_ns", std::to_string(scannedNs));
+
+    EXPECT_THROW(biosStringTable.findHandle("attr_missing"),
+                 std::invalid_argument);
+    EXPECT_EQ(attrIndex.findByHandle(attrTable, 0xffff), nullptr);
+}
+
+TEST(BIOSAttrValueTableIndex, replaceEntryInPlace)
+{
+    Table valueTable;
+    table::attribute_value::constructStringEntry(valueTable, 1,
+                                                 PLDM_BIOS_STRING, "abcd");
+    table::attribute_value::constructIntegerEntry(valueTable, 2,
+                                                  PLDM_BIOS_INTEGER, 10);
+    table::appendPadAndChecksum(valueTable);
+
+    BIOSAttrValueTableIndex index(valueTable);
+    auto oldEntry = index.findByHandle(valueTable, 1);
+    ASSERT_NE(oldEntry, nullptr);
+    EXPECT_EQ(index.findByHandle(valueTable, 3), nullptr);
+
+    Table newEntry;
+    table::attribute_value::constructStringEntry(newEntry, 1, PLDM_BIOS_STRING,
+                                                 "wxyz");
+    auto expected = table::attribute_value::updateTable(
+        valueTable, newEntry.data(), newEntry.size());
+    ASSERT_TRUE(expected.has_value());
+
+    ASSERT_TRUE(table::attribute_value::replaceEntry(
+        valueTable, oldEntry, newEntry.data(), newEntry.size()));
+    EXPECT_EQ(valueTable, *expected);
+    EXPECT_TRUE(pldm_bios_table_checksum(valueTable.data(), valueTable.size()));
+    EXPECT_EQ(table::attribute_value::decodeStringEntry(
+                  index.findByHandle(valueTable, 1)),
+              "wxyz");
+
+    Table longerEntry;
+    table::attribute_value::constructStringEntry(longerEntry, 1,
+                                                 PLDM_BIOS_STRING, "abcde");
+    EXPECT_FALSE(table::attribute_value::replaceEntry(
+        valueTable, index.findByHandle(valueTable, 1), longerEntry.data(),
+        longerEntry.size()));
+    EXPECT_EQ(valueTable, *expected);
+}
+
+TEST(BIOSTableTransfer, singlePart)
+{
+    BIOSTableTransfer transfer(64);
+    BIOSTableTransfer::Part part{};
+    EXPECT_EQ(transfer.getPart(PLDM_BIOS_STRING_TABLE, 1, 64, 0,
+                               PLDM_GET_FIRSTPART, part),
+              PLDM_SUCCESS);
+    EXPECT_EQ(part.offset, 0);
+    EXPECT_EQ(part.length, 64);
+    EXPECT_EQ(part.nextTransferHandle, 0);
+    EXPECT_EQ(part.transferFlag, PLDM_START_AND_END);
+
+    // A zero part size keeps any table in a single part
+    BIOSTableTransfer whole(0);
+    EXPECT_EQ(whole.getPart(PLDM_BIOS_ATTR_TABLE, 1, 100000, 0,
+                            PLDM_GET_FIRSTPART, part),
+              PLDM_SUCCESS);
+    EXPECT_EQ(part.length, 100000);
+    EXPECT_EQ(part.nextTransferHandle, 0);
+    EXPECT_EQ(part.transferFlag, PLDM_START_AND_END);
+}
+
+TEST(BIOSTableTransfer, multipleParts)
+{
+    BIOSTableTransfer transfer(64);
+    BIOSTableTransfer::Part part{};
+    EXPECT_EQ(transfer.getPart(PLDM_BIOS_ATTR_TABLE, 1, 150, 0,
+                               PLDM_GET_FIRSTPART, part),
+              PLDM_SUCCESS);
+    EXPECT_EQ(part.offset, 0);
+    EXPECT_EQ(part.length, 64);
+    EXPECT_EQ(part.nextTransferHandle, 64);
+    EXPECT_EQ(part.transferFlag, PLDM_START);
+
+    EXPECT_EQ(transfer.getPart(PLDM_BIOS_ATTR_TABLE, 1, 150,
+                               part.nextTransferHandle, PLDM_GET_NEXTPART,
+                               part),
+              PLDM_SUCCESS);
+    EXPECT_EQ(part.offset, 64);
+    EXPECT_EQ(part.length, 64);
+    EXPECT_EQ(part.nextTransferHandle, 128);
+    EXPECT_EQ(part.transferFlag, PLDM_MIDDLE);
+
+    EXPECT_EQ(transfer.getPart(PLDM_BIOS_ATTR_TABLE, 1, 150,
+                               part.nextTransferHandle, PLDM_GET_NEXTPART,
+                               part),
+              PLDM_SUCCESS);
+    EXPECT_EQ(part.offset, 128);
+    EXPECT_EQ(part.length, 22);
+    EXPECT_EQ(part.nextTransferHandle, 0);
+    EXPECT_EQ(part.transferFlag, PLDM_END);
+
+    /* The last part can be retried */
+    EXPECT_EQ(transfer.getPart(PLDM_BIOS_ATTR_TABLE, 1, 150, 128,
+                               PLDM_GET_NEXTPART, part),
+              PLDM_SUCCESS);
+    EXPECT_EQ(part.transferFlag, PLDM_END);
+}
+
+TEST(BIOSTableTransfer, invalidRequests)
+{
+    BIOSTableTransfer transfer(64);
+    BIOSTableTransfer::Part part{};
+
+    /* No transfer started */
+    EXPECT_EQ(transfer.getPart(PLDM_BIOS_ATTR_TABLE, 1, 150, 64,
+                               PLDM_GET_NEXTPART, part),
+              BIOSTableTransfer::invalidDataTransferHandle);
+    EXPECT_EQ(transfer.getPart(PLDM_BIOS_ATTR_TABLE, 1, 150, 0, 0x05, part),
+              BIOSTableTransfer::invalidTransferOperationFlag);
+
+    EXPECT_EQ(transfer.getPart(PLDM_BIOS_ATTR_TABLE, 1, 150, 0,
+                               PLDM_GET_FIRSTPART, part),
+              PLDM_SUCCESS);
+    /* Handle out of the table */
+    EXPECT_EQ(transfer.getPart(PLDM_BIOS_ATTR_TABLE, 1, 150, 150,
+                               PLDM_GET_NEXTPART, part),
+              BIOSTableTransfer::invalidDataTransferHandle);
+    EXPECT_EQ(transfer.getPart(PLDM_BIOS_ATTR_TABLE, 1, 150, 0,
+                               PLDM_GET_NEXTPART, part),
+              BIOSTableTransfer::invalidDataTransferHandle);
+    /* Transfers of the other tables are independent */
+    EXPECT_EQ(transfer.getPart(PLDM_BIOS_STRING_TABLE, 1, 150, 64,
+                               PLDM_GET_NEXTPART, part),
+              BIOSTableTransfer::invalidDataTransferHandle);
+    /* The table changed since the transfer started */
+    EXPECT_EQ(transfer.getPart(PLDM_BIOS_ATTR_TABLE, 2, 150, 64,
+                               PLDM_GET_NEXTPART, part),
+              BIOSTableTransfer::invalidDataTransferHandle);
+    /* A new transfer can start */
+    EXPECT_EQ(transfer.getPart(PLDM_BIOS_ATTR_TABLE, 2, 150, 0,
+                               PLDM_GET_FIRSTPART, part),
+              PLDM_SUCCESS);
+    EXPECT_EQ(transfer.getPart(PLDM_BIOS_ATTR_TABLE, 2, 150, 64,
+                               PLDM_GET_NEXTPART, part),
+              PLDM_SUCCESS);
+}
@@ -4,9 +4,12 @@
 
 #include <config.h>
 #include <libpldm/pdr.h>
+#include <libpldm/utils.h>
 
 #include <sdbusplus/message.hpp>
 
+#include <cstring>
+
 #include <gtest/gtest.h>
 
 TEST(FruParser, allScenarios)
@@ -182,3 +185,158 @@ TEST(FruImpl, entityByObjectPath)
     entityPtr = mockedFruHandler.getEntityByObjectPath(invalidIface);
     ASSERT_TRUE(!entityPtr);
 }
+
+TEST(FruImpl, incrementalUpdate)
+{
+    using namespace pldm::responder::dbus;
+    std::unique_ptr<pldm_pdr, decltype(&pldm_pdr_destroy)> pdrRepo(
+        pldm_pdr_init(), pldm_pdr_destroy);
+    std::unique_ptr<pldm_entity_association_tree,
+                    decltype(&pldm_entity_association_tree_destroy)>
+        entityTree(pldm_entity_association_tree_init(),
+                   pldm_entity_association_tree_destroy);
+    std::unique_ptr<pldm_entity_association_tree,
+                    decltype(&pldm_entity_association_tree_destroy)>
+        bmcEntityTree(pldm_entity_association_tree_init(),
+                      pldm_entity_association_tree_destroy);
+
+    auto cpu = [](const std::string& serialNumber, bool present) {
+        return InterfaceMap{
+            {"xyz.openbmc_project.Inventory.Item.Cpu", {}},
+            {"xyz.openbmc_project.Inventory.Item", {{"Present", present}}},
+            {"xyz.openbmc_project.Inventory.Decorator.Asset",
+             {{"PartNumber", std::string("PN")},
+              {"SerialNumber", serialNumber}}}};
+    };
+    const std::string motherboard =
+        "/xyz/openbmc_project/inventory/system/chassis/motherboard";
+    const std::string cpu0 = motherboard + "/cpu0";
+    const std::string cpu1 = motherboard + "/cpu1";
+    const std::string cpu2 = motherboard + "/cpu2";
+
+    ObjectValueTree objects{
+        {sdbusplus::message::object_path(
+             "/xyz/openbmc_project/inventory/system"),
+         {{"xyz.openbmc_project.Inventory.Item.System", {}}}},
+        {sdbusplus::message::object_path(
+             "/xyz/openbmc_project/inventory/system/chassis"),
+         {{"xyz.openbmc_project.Inventory.Item.Chassis", {}}}},
+        {sdbusplus::message::object_path(motherboard),
+         {{"xyz.openbmc_project.Inventory.Item.Board.Motherboard", {}}}},
+        {sdbusplus::message::object_path(cpu0), cpu("0000", true)},
+        {sdbusplus::message::object_path(cpu1), cpu("1111", false)}};
+
+    pldm::responder::FruImpl fru(
+        "./fru_jsons/good", "./fru_jsons/fru_master/fru_master.json",
+        pdrRepo.get(), entityTree.get(), bmcEntityTree.get(), nullptr);
+    fru.buildFRUTable(objects);
+
+    // Only the present CPU has records
+    EXPECT_EQ(fru.numRSI(), 1);
+    auto records = fru.numRecords();
+    ASSERT_GT(records, 0);
+    auto checksum = fru.checkSum();
+    auto pdrs = pldm_pdr_get_record_count(pdrRepo.get());
+
+    // cpu1 is plugged
+    fru.propertiesChanged(cpu1, "xyz.openbmc_project.Inventory.Item",
+                          {{"Present", true}});
+    EXPECT_EQ(fru.numRSI(), 2);
+    EXPECT_EQ(fru.numRecords(), 2 * records);
+    EXPECT_EQ(pldm_pdr_get_record_count(pdrRepo.get()), pdrs + 1);
+    EXPECT_NE(fru.checkSum(), checksum);
+
+    // Its serial number is updated in place
+    auto size = fru.size();
+    fru.propertiesChanged(cpu1, "xyz.openbmc_project.Inventory.Decorator.Asset",
+                          {{"SerialNumber", std::string("111111")}});
+    EXPECT_EQ(fru.numRSI(), 2);
+    EXPECT_EQ(fru.numRecords(), 2 * records);
+    EXPECT_EQ(pldm_pdr_get_record_count(pdrRepo.get()), pdrs + 1);
+    EXPECT_GT(fru.size(), size);
+
+    // Properties which are not FRU fields leave the table alone
+    checksum = fru.checkSum();
+    fru.propertiesChanged(
+        cpu1, "xyz.openbmc_project.State.Decorator.OperationalStatus",
+        {{"Functional", true}});
+    EXPECT_EQ(fru.checkSum(), checksum);
+
+    // cpu0 is removed from the inventory
+    fru.interfacesRemoved(cpu0,
+                          {"xyz.openbmc_project.Inventory.Item.Cpu",
+                           "xyz.openbmc_project.Inventory.Item",
+                           "xyz.openbmc_project.Inventory.Decorator.Asset"});
+    EXPECT_EQ(fru.numRSI(), 1);
+    EXPECT_EQ(fru.numRecords(), records);
+    EXPECT_EQ(pldm_pdr_get_record_count(pdrRepo.get()), pdrs);
+    EXPECT_FALSE(fru.getAssociateEntityMap().contains(cpu0));
+
+    // cpu2 is added to the inventory
+    fru.interfacesAdded(cpu2, cpu("2222", true));
+    EXPECT_EQ(fru.numRSI(), 2);
+    EXPECT_EQ(fru.numRecords(), 2 * records);
+    EXPECT_EQ(pldm_pdr_get_record_count(pdrRepo.get()), pdrs + 1);
+    EXPECT_TRUE(fru.getAssociateEntityMap().contains(cpu2));
+}
+
+TEST(FruImpl, tablePart)
+{
+    using namespace pldm::responder;
+    using namespace pldm::responder::dbus;
+    std::unique_ptr<pldm_pdr, decltype(&pldm_pdr_destroy)> pdrRepo(
+        pldm_pdr_init(), pldm_pdr_destroy);
+    std::unique_ptr<pldm_entity_association_tree,
+                    decltype(&pldm_entity_association_tree_destroy)>
+        entityTree(pldm_entity_association_tree_init(),
+                   pldm_entity_association_tree_destroy);
+    std::unique_ptr<pldm_entity_association_tree,
+                    decltype(&pldm_entity_association_tree_destroy)>
+        bmcEntityTree(pldm_entity_association_tree_init(),
+                      pldm_entity_association_tree_destroy);
+
+    const std::string cpu0 =
+        "/xyz/openbmc_project/inventory/system/chassis/motherboard/cpu0";
+    ObjectValueTree objects{
+        {sdbusplus::message::object_path(
+             "/xyz/openbmc_project/inventory/system"),
+         {{"xyz.openbmc_project.Inventory.Item.System", {}}}},
+        {sdbusplus::message::object_path(cpu0),
+         {{"xyz.openbmc_project.Inventory.Item.Cpu", {}},
+          {"xyz.openbmc_project.Inventory.Item", {{"Present", true}}},
+          {"xyz.openbmc_project.Inventory.Decorator.Asset",
+           {{"SerialNumber", std::string("12345")}}}}}};
+
+    FruImpl fru("./fru_jsons/good", "./fru_jsons/fru_master/fru_master.json",
+                pdrRepo.get(), entityTree.get(), bmcEntityTree.get(),
+                nullptr);
+    fru.buildFRUTable(objects);
+    ASSERT_GT(fru.size(), 0);
+
+    // The table is sent padded and followed by its checksum
+    FruImpl::Part part{};
+    ASSERT_EQ(fru.getFRUTablePart(0, PLDM_GET_FIRSTPART, part), PLDM_SUCCESS);
+    EXPECT_EQ(part.transferFlag, PLDM_START_AND_END);
+    EXPECT_EQ(part.nextTransferHandle, 0);
+    EXPECT_EQ(part.length % 4, 0);
+    EXPECT_EQ(part.length, fru.size() +
+                               pldm::utils::getNumPadBytes(fru.size()) +
+                               sizeof(uint32_t));
+    uint32_t checksum = 0;
+    std::memcpy(&checksum, part.data + part.length - sizeof(checksum),
+                sizeof(checksum));
+    EXPECT_EQ(checksum, fru.checkSum());
+    EXPECT_EQ(checksum, crc32(part.data, part.length - sizeof(checksum)));
+
+    EXPECT_EQ(fru.getFRUTablePart(0, PLDM_GET_NEXTPART, part),
+              PLDM_FRU_INVALID_DATA_TRANSFER_HANDLE);
+    EXPECT_EQ(fru.getFRUTablePart(0, 0xff, part),
+              FruImpl::invalidTransferOperationFlag);
+
+    // Filtering a record set only returns its records
+    std::vector<uint8_t> fruData;
+    EXPECT_EQ(fru.getFRURecordByOption(fruData, 0, 1, 0, 0), PLDM_SUCCESS);
+    EXPECT_EQ(fruData.size(), part.length);
+    EXPECT_EQ(fru.getFRURecordByOption(fruData, 0, 2, 0, 0),
+              PLDM_FRU_DATA_STRUCTURE_TABLE_UNAVAILABLE);
+}
@@ -0,0 +1,382 @@
+#include "dma_engine.hpp"
+
+#include "utils.hpp"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <cerrno>
+
+PHOSPHOR_LOG2_USING;
+
+namespace pldm
+{
+namespace responder
+{
+namespace dma
+{
+/** @struct AspeedXdmaOp
+ *
+ * Structure representing XDMA operation
+ */
+struct AspeedXdmaOp
+{
+    uint64_t hostAddr; //!< the DMA address on the host side, configured by
+                       //!< PCI subsystem.
+    uint32_t len;      //!< the size of the transfer in bytes, it should be a
+                       //!< multiple of 16 bytes
+    uint32_t upstream; //!< boolean indicating the direction of the DMA
+                       //!< operation, true means a transfer from BMC to host.
+};
+
+constexpr auto xdmaDev = "/dev/aspeed-xdma";
+
+static size_t pageAligned(size_t length)
+{
+    static const size_t pageSize = getpagesize();
+    return (length + pageSize - 1) / pageSize * pageSize;
+}
+
+AspeedXdma::AspeedXdma(size_t windowSize) : windowSize(pageAligned(windowSize))
+{}
+
+AspeedXdma::~AspeedXdma()
+{
+    if (mem)
+    {
+        munmap(mem, windowSize);
+    }
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+}
+
+int AspeedXdma::open()
+{
+    if (mem)
+    {
+        return 0;
+    }
+
+    if (fd < 0)
+    {
+        fd = ::open(xdmaDev, O_RDWR | O_NONBLOCK | O_CLOEXEC);
+        if (fd < 0)
+        {
+            auto rc = -errno;
+            error("Failed to open the XDMA device, RC={RC}", "RC", rc);
+            return rc;
+        }
+    }
+
+    auto addr = mmap(nullptr, windowSize, PROT_READ | PROT_WRITE, MAP_SHARED,
+                     fd, 0);
+    if (MAP_FAILED == addr)
+    {
+        auto rc = -errno;
+        error("Failed to mmap the XDMA device, RC={RC}", "RC", rc);
+        return rc;
+    }
+    mem = static_cast<uint8_t*>(addr);
+    return 0;
+}
+
+std::span<uint8_t> AspeedXdma::window()
+{
+    return mem ? std::span<uint8_t>(mem, windowSize) : std::span<uint8_t>();
+}
+
+int AspeedXdma::start(uint64_t address, uint32_t length, bool upstream)
+{
+    AspeedXdmaOp xdmaOp;
+    xdmaOp.upstream = upstream ? 1 : 0;
+    xdmaOp.hostAddr = address;
+    xdmaOp.len = length;
+
+    /* The device is non-blocking and refuses an operation with EAGAIN while
+     * the engine is busy, wait until it can take one.
+     */
+    while (write(fd, &xdmaOp, sizeof(xdmaOp)) < 0)
+    {
+        if (errno == EINTR)
+        {
+            continue;
+        }
+        if (errno != EAGAIN)
+        {
+            return -errno;
+        }
+        pollfd pfd{fd, POLLOUT, 0};
+        if (poll(&pfd, 1, -1) < 0 && errno != EINTR)
+        {
+            return -errno;
+        }
+        if (pfd.revents & (POLLERR | POLLHUP | POLLNVAL))
+        {
+            return -EIO;
+        }
+    }
+    return 0;
+}
+
+int AspeedXdma::wait()
+{
+    /* The window is not touched before the operation completes, even when
+     * interrupted, the mapping staying in place across operations.
+     */
+    pollfd pfd{fd, POLLIN, 0};
+    while (true)
+    {
+        auto rc = poll(&pfd, 1, -1);
+        if (rc < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return -errno;
+        }
+        if (pfd.revents & (POLLERR | POLLHUP | POLLNVAL))
+        {
+            return -EIO;
+        }
+        if (pfd.revents & POLLIN)
+        {
+            return 0;
+        }
+    }
+}
+
+FileXdma::FileXdma(int hostFd, size_t windowSize) :
+    hostFd(hostFd), windowSize(pageAligned(windowSize))
+{}
+
+FileXdma::~FileXdma()
+{
+    if (mem)
+    {
+        munmap(mem, windowSize);
+    }
+}
+
+int FileXdma::open()
+{
+    if (mem)
+    {
+        return 0;
+    }
+    auto addr = mmap(nullptr, windowSize, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (MAP_FAILED == addr)
+    {
+        return -errno;
+    }
+    mem = static_cast<uint8_t*>(addr);
+    return 0;
+}
+
+std::span<uint8_t> FileXdma::window()
+{
+    return mem ? std::span<uint8_t>(mem, windowSize) : std::span<uint8_t>();
+}
+
+int FileXdma::start(uint64_t address, uint32_t length, bool upstream)
+{
+    operations++;
+    auto rc = upstream ? pwrite(hostFd, mem, length, address)
+                       : pread(hostFd, mem, length, address);
+    if (rc < 0)
+    {
+        pending = -errno;
+    }
+    else
+    {
+        pending = rc == static_cast<ssize_t>(length) ? 0 : -EIO;
+    }
+    return 0;
+}
+
+int FileXdma::wait()
+{
+    return pending;
+}
+
+DmaEngine& DmaEngine::get()
+{
+    static DmaEngine engine(std::make_unique<AspeedXdma>(DMA_MAXSIZE));
+    return engine;
+}
+
+int DmaEngine::prepare(uint32_t length)
+{
+    auto rc = backend->open();
+    if (rc < 0)
+    {
+        return rc;
+    }
+    if (length > backend->window().size())
+    {
+        error("DMA length exceeds the XDMA window, LENGTH={LEN} WINDOW={SIZE}",
+              "LEN", length, "SIZE", backend->window().size());
+        return -EINVAL;
+    }
+    return 0;
+}
+
+int DmaEngine::transferDataHost(int fd, uint32_t offset, uint32_t length,
+                                uint64_t address, bool upstream)
+{
+    auto rc = prepare(length);
+    if (rc < 0)
+    {
+        return rc;
+    }
+    auto window = backend->window();
+
+    if (upstream)
+    {
+        rc = lseek(fd, offset, SEEK_SET);
+        if (rc == -1)
+        {
+            error(
+                "transferDataHost upstream : lseek failed, ERROR={ERR}, UPSTREAM={UPSTREAM}, OFFSET={OFFSET}",
+                "ERR", errno, "UPSTREAM", upstream, "OFFSET", offset);
+            return rc;
+        }
+
+        /* Read the file straight into the window */
+        uint32_t count = 0;
+        while (count < length)
+        {
+            rc = read(fd, window.data() + count, length - count);
+            if (rc == -1 && errno == EINTR)
+            {
+                continue;
+            }
+            if (rc == -1)
+            {
+                error(
+                    "transferDataHost upstream : file read failed, ERROR={ERR}, UPSTREAM={UPSTREAM}, LENGTH={LEN}, OFFSET={OFFSET}",
+                    "ERR", errno, "UPSTREAM", upstream, "LEN", length,
+                    "OFFSET", offset);
+                return rc;
+            }
+            if (rc == 0)
+            {
+                break;
+            }
+            count += rc;
+        }
+        if (count != length)
+        {
+            error(
+                "transferDataHost upstream : mismatch between number of characters to read and the length read, LENGTH={LEN} COUNT={RC}",
+                "LEN", length, "RC", count);
+            return -1;
+        }
+    }
+
+    rc = backend->start(address, length, upstream);
+    if (rc < 0)
+    {
+        error(
+            "transferDataHost : Failed to execute the DMA operation, RC={RC} UPSTREAM={UPSTREAM} ADDRESS={ADDR} LENGTH={LEN}",
+            "RC", rc, "UPSTREAM", upstream, "ADDR", address, "LEN", length);
+        return rc;
+    }
+
+    if (upstream)
+    {
+        /* Read the next chunk ahead while the DMA operation runs */
+        posix_fadvise(fd, static_cast<off_t>(offset) + length,
+                      window.size(), POSIX_FADV_WILLNEED);
+    }
+
+    rc = backend->wait();
+    if (rc < 0)
+    {
+        error(
+            "transferDataHost : DMA operation failed, RC={RC} UPSTREAM={UPSTREAM} ADDRESS={ADDR} LENGTH={LEN}",
+            "RC", rc, "UPSTREAM", upstream, "ADDR", address, "LEN", length);
+        return rc;
+    }
+
+    if (!upstream)
+    {
+        rc = lseek(fd, offset, SEEK_SET);
+        if (rc == -1)
+        {
+            error(
+                "transferDataHost downstream : lseek failed, ERROR={ERR}, UPSTREAM={UPSTREAM}, OFFSET={OFFSET}",
+                "ERR", errno, "UPSTREAM", upstream, "OFFSET", offset);
+            return rc;
+        }
+
+        /* Write the file straight from the window */
+        uint32_t count = 0;
+        while (count < length)
+        {
+            rc = write(fd, window.data() + count, length - count);
+            if (rc == -1 && errno == EINTR)
+            {
+                continue;
+            }
+            if (rc == -1)
+            {
+                error(
+                    "transferDataHost downstream : file write failed, ERROR={ERR}, UPSTREAM={UPSTREAM}, LENGTH={LEN}, OFFSET={OFFSET}",
+                    "ERR", errno, "UPSTREAM", upstream, "LEN", length,
+                    "OFFSET", offset);
+                return rc;
+            }
+            count += rc;
+        }
+    }
+
+    return 0;
+}
+
+int DmaEngine::transferHostDataToSocket(int fd, uint32_t length,
+                                        uint64_t address)
+{
+    auto rc = prepare(length);
+    if (rc < 0)
+    {
+        return rc;
+    }
+
+    rc = backend->start(address, length, false);
+    if (rc == 0)
+    {
+        rc = backend->wait();
+    }
+    if (rc < 0)
+    {
+        error(
+            "transferHostDataToSocket: Failed to execute the DMA operation, RC={RC} ADDRESS={ADDR} LENGTH={LEN}",
+            "RC", rc, "ADDR", address, "LEN", length);
+        return rc;
+    }
+
+    rc = utils::writeToUnixSocket(
+        fd, reinterpret_cast<const char*>(backend->window().data()), length);
+    if (rc < 0)
+    {
+        rc = -errno;
+        close(fd);
+        error(
+            "transferHostDataToSocket: Closing socket as writeToUnixSocket faile with RC={RC}",
+            "RC", rc);
+        return rc;
+    }
+    return 0;
+}
+
+} // namespace dma
+} // namespace responder
+} // namespace pldm
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace pldm
+{
+namespace responder
+{
+namespace dma
+{
+
+/** @class XdmaBackend
+ *
+ *  A BMC memory window the host side of a DMA operation reads from or writes
+ *  to, and the engine moving the data between the window and host memory.
+ */
+class XdmaBackend
+{
+  public:
+    virtual ~XdmaBackend() = default;
+
+    /** @brief Open and map the window, does nothing if already done
+     *
+     *  @return 0 on success, negative errno on failure
+     */
+    virtual int open() = 0;
+
+    /** @brief Get the mapped window, empty until open() succeeds */
+    virtual std::span<uint8_t> window() = 0;
+
+    /** @brief Start a DMA operation between the start of the window and the
+     *         host memory
+     *
+     *  @param[in] address - DMA address on the host
+     *  @param[in] length - number of bytes to transfer
+     *  @param[in] upstream - true for a transfer from the BMC to the host
+     *
+     *  @return 0 on success, negative errno on failure
+     */
+    virtual int start(uint64_t address, uint32_t length, bool upstream) = 0;
+
+    /** @brief Wait for the operation started to complete
+     *
+     *  @return 0 on success, negative errno on failure
+     */
+    virtual int wait() = 0;
+};
+
+/** @class AspeedXdma
+ *
+ *  The AST2600 XDMA engine. The device is opened non-blocking so a DMA
+ *  operation runs while the next chunk of the file is read ahead, and its
+ *  reserved memory is mapped once and kept mapped.
+ */
+class AspeedXdma : public XdmaBackend
+{
+  public:
+    /** @brief Constructor
+     *
+     *  @param[in] windowSize - size of the window to map
+     */
+    explicit AspeedXdma(size_t windowSize);
+    ~AspeedXdma() override;
+
+    AspeedXdma(const AspeedXdma&) = delete;
+    AspeedXdma& operator=(const AspeedXdma&) = delete;
+
+    int open() override;
+    std::span<uint8_t> window() override;
+    int start(uint64_t address, uint32_t length, bool upstream) override;
+    int wait() override;
+
+  private:
+    const size_t windowSize;
+    int fd = -1;
+    uint8_t* mem = nullptr;
+};
+
+/** @class FileXdma
+ *
+ *  XDMA engine stand in whose host memory is a file, the DMA address being the
+ *  offset in it, for testing and benchmarking without the hardware.
+ */
+class FileXdma : public XdmaBackend
+{
+  public:
+    /** @brief Constructor
+     *
+     *  @param[in] hostFd - file acting as the host memory, not owned
+     *  @param[in] windowSize - size of the window
+     */
+    FileXdma(int hostFd, size_t windowSize);
+    ~FileXdma() override;
+
+    FileXdma(const FileXdma&) = delete;
+    FileXdma& operator=(const FileXdma&) = delete;
+
+    int open() override;
+    std::span<uint8_t> window() override;
+    int start(uint64_t address, uint32_t length, bool upstream) override;
+    int wait() override;
+
+    /** @brief Get the number of DMA operations started */
+    uint64_t getOperations() const
+    {
+        return operations;
+    }
+
+  private:
+    const int hostFd;
+    const size_t windowSize;
+    uint8_t* mem = nullptr;
+    int pending = 0;
+    uint64_t operations = 0;
+};
+
+/** @class DmaEngine
+ *
+ *  Transfers file data to and from the host through an XDMA backend opened and
+ *  mapped on first use and kept for the daemon lifetime. Upstream, the file is
+ *  read straight into the window and the next chunk is read ahead while the
+ *  DMA operation of the current one runs; downstream, the file is written
+ *  straight from the window.
+ */
+class DmaEngine
+{
+  public:
+    explicit DmaEngine(std::unique_ptr<XdmaBackend> backend) :
+        backend(std::move(backend))
+    {}
+
+    /** @brief Get the engine of the XDMA device */
+    static DmaEngine& get();
+
+    /** @brief Transfer a chunk of a file between the BMC and the host
+     *
+     *  @param[in] fd - file to transfer data from or to
+     *  @param[in] offset - offset in the file
+     *  @param[in] length - length of the chunk, at most the window size
+     *  @param[in] address - DMA address on the host
+     *  @param[in] upstream - true for a transfer to the host
+     *
+     *  @return 0 on success, negative errno or -1 on failure
+     */
+    int transferDataHost(int fd, uint32_t offset, uint32_t length,
+                         uint64_t address, bool upstream);
+
+    /** @brief Transfer a chunk of host memory to a unix socket
+     *
+     *  @param[in] fd - unix socket
+     *  @param[in] length - length of the chunk, at most the window size
+     *  @param[in] address - DMA address on the host
+     *
+     *  @return 0 on success, negative errno on failure
+     */
+    int transferHostDataToSocket(int fd, uint32_t length, uint64_t address);
+
+  private:
+    /** @brief Open the backend and check a chunk fits in its window
+     *
+     *  @return 0 on success, negative errno on failure
+     */
+    int prepare(uint32_t length);
+
+    std::unique_ptr<XdmaBackend> backend;
+};
+
+} // namespace dma
+} // namespace responder
+} // namespace pldm
@@ -7,7 +7,6 @@
 
 #include <fcntl.h>
 #include <libpldm/base.h>
-#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -31,217 +30,15 @@ namespace fs = std::filesystem;
 
 namespace dma
 {
-/** @struct AspeedXdmaOp
- *
- * Structure representing XDMA operation
- */
-struct AspeedXdmaOp
-{
-    uint64_t hostAddr; //!< the DMA address on the host side, configured by
-                       //!< PCI subsystem.
-    uint32_t len;      //!< the size of the transfer in bytes, it should be a
-                       //!< multiple of 16 bytes
-    uint32_t upstream; //!< boolean indicating the direction of the DMA
-                       //!< operation, true means a transfer from BMC to host.
-};
-
-constexpr auto xdmaDev = "/dev/aspeed-xdma";
-
 int DMA::transferHostDataToSocket(int fd, uint32_t length, uint64_t address)
 {
-    static const size_t pageSize = getpagesize();
-    uint32_t numPages = length / pageSize;
-    uint32_t pageAlignedLength = numPages * pageSize;
-
-    if (length > pageAlignedLength)
-    {
-        pageAlignedLength += pageSize;
-    }
-
-    auto mmapCleanup = [pageAlignedLength](void* vgaMem) {
-        munmap(vgaMem, pageAlignedLength);
-    };
-
-    int dmaFd = -1;
-    int rc = 0;
-    dmaFd = open(xdmaDev, O_RDWR);
-    if (dmaFd < 0)
-    {
-        rc = -errno;
-        error(
-            "transferHostDataToSocket: Failed to open the XDMA device, RC={RC}",
-            "RC", rc);
-        return rc;
-    }
-
-    pldm::utils::CustomFD xdmaFd(dmaFd);
-
-    void* vgaMem;
-    vgaMem = mmap(nullptr, pageAlignedLength, PROT_READ, MAP_SHARED, xdmaFd(),
-                  0);
-    if (MAP_FAILED == vgaMem)
-    {
-        rc = -errno;
-        error(
-            "transferHostDataToSocket : Failed to mmap the XDMA device, RC={RC}",
-            "RC", rc);
-        return rc;
-    }
-
-    std::unique_ptr<void, decltype(mmapCleanup)> vgaMemPtr(vgaMem, mmapCleanup);
-
-    AspeedXdmaOp xdmaOp;
-    xdmaOp.upstream = 0;
-    xdmaOp.hostAddr = address;
-    xdmaOp.len = length;
-
-    rc = write(xdmaFd(), &xdmaOp, sizeof(xdmaOp));
-    if (rc < 0)
-    {
-        rc = -errno;
-        error(
-            "transferHostDataToSocket: Failed to execute the DMA operation, RC={RC} ADDRESS={ADDR} LENGTH={LEN}",
-            "RC", rc, "ADDR", address, "LEN", length);
-        return rc;
-    }
-
-    rc = writeToUnixSocket(fd, static_cast<const char*>(vgaMemPtr.get()),
-                           length);
-    if (rc < 0)
-    {
-        rc = -errno;
-        close(fd);
-        error(
-            "transferHostDataToSocket: Closing socket as writeToUnixSocket faile with RC={RC}",
-            "RC", rc);
-        return rc;
-    }
-    return 0;
+    return engine.transferHostDataToSocket(fd, length, address);
 }
 
 int DMA::transferDataHost(int fd, uint32_t offset, uint32_t length,
                           uint64_t address, bool upstream)
 {
-    static const size_t pageSize = getpagesize();
-    uint32_t numPages = length / pageSize;
-    uint32_t pageAlignedLength = numPages * pageSize;
-
-    if (length > pageAlignedLength)
-    {
-        pageAlignedLength += pageSize;
-    }
-
-    int rc = 0;
-    auto mmapCleanup = [pageAlignedLength, &rc](void* vgaMem) {
-        if (rc != -EINTR)
-        {
-            munmap(vgaMem, pageAlignedLength);
-        }
-        else
-        {
-            error(
-                "transferDataHost: Received interrupt during DMA transfer. Skipping Unmap.");
-        }
-    };
-
-    int dmaFd = -1;
-    dmaFd = open(xdmaDev, O_RDWR);
-    if (dmaFd < 0)
-    {
-        rc = -errno;
-        error("transferDataHost : Failed to open the XDMA device, RC={RC}",
-              "RC", rc);
-        return rc;
-    }
-
-    pldm::utils::CustomFD xdmaFd(dmaFd);
-
-    void* vgaMem;
-    vgaMem = mmap(nullptr, pageAlignedLength, upstream ? PROT_WRITE : PROT_READ,
-                  MAP_SHARED, xdmaFd(), 0);
-    if (MAP_FAILED == vgaMem)
-    {
-        rc = -errno;
-        error("transferDataHost : Failed to mmap the XDMA device, RC={RC}",
-              "RC", rc);
-        return rc;
-    }
-
-    std::unique_ptr<void, decltype(mmapCleanup)> vgaMemPtr(vgaMem, mmapCleanup);
-
-    if (upstream)
-    {
-        rc = lseek(fd, offset, SEEK_SET);
-        if (rc == -1)
-        {
-            error(
-                "transferDataHost upstream : lseek failed, ERROR={ERR}, UPSTREAM={UPSTREAM}, OFFSET={OFFSET}",
-                "ERR", errno, "UPSTREAM", upstream, "OFFSET", offset);
-            return rc;
-        }
-
-        // Writing to the VGA memory should be aligned at page boundary,
-        // otherwise write data into a buffer aligned at page boundary and
-        // then write to the VGA memory.
-        std::vector<char> buffer{};
-        buffer.resize(pageAlignedLength);
-        rc = read(fd, buffer.data(), length);
-        if (rc == -1)
-        {
-            error(
-                "transferDataHost upstream : file read failed, ERROR={ERR}, UPSTREAM={UPSTREAM}, LENGTH={LEN}, OFFSET={OFFSET}",
-                "ERR", errno, "UPSTREAM", upstream, "LEN", length, "OFFSET",
-                offset);
-            return rc;
-        }
-        if (rc != static_cast<int>(length))
-        {
-            error(
-                "transferDataHost upstream : mismatch between number of characters to read and the length read, LENGTH={LEN} COUNT={RC}",
-                "LEN", length, "RC", rc);
-            return -1;
-        }
-        memcpy(static_cast<char*>(vgaMemPtr.get()), buffer.data(),
-               pageAlignedLength);
-    }
-
-    AspeedXdmaOp xdmaOp;
-    xdmaOp.upstream = upstream ? 1 : 0;
-    xdmaOp.hostAddr = address;
-    xdmaOp.len = length;
-
-    rc = write(xdmaFd(), &xdmaOp, sizeof(xdmaOp));
-    if (rc < 0)
-    {
-        rc = -errno;
-        error(
-            "transferDataHost : Failed to execute the DMA operation, RC={RC} UPSTREAM={UPSTREAM} ADDRESS={ADDR} LENGTH={LEN}",
-            "RC", rc, "UPSTREAM", upstream, "ADDR", address, "LEN", length);
-        return rc;
-    }
-
-    if (!upstream)
-    {
-        rc = lseek(fd, offset, SEEK_SET);
-        if (rc == -1)
-        {
-            error(
-                "transferDataHost downstream : lseek failed, ERROR={ERR}, UPSTREAM={UPSTREAM}, OFFSET={OFFSET}",
-                "ERR", errno, "UPSTREAM", upstream, "OFFSET", offset);
-            return rc;
-        }
-        rc = write(fd, static_cast<const char*>(vgaMemPtr.get()), length);
-        if (rc == -1)
-        {
-            error(
-                "transferDataHost downstream : file write failed, ERROR={ERR}, UPSTREAM={UPSTREAM}, LENGTH={LEN}, OFFSET={OFFSET}",
-                "ERR", errno, "UPSTREAM", upstream, "LEN", length, "OFFSET",
-                offset);
-            return rc;
-        }
-    }
-
-    return 0;
+    return engine.transferDataHost(fd, offset, length, address, upstream);
 }
 
 } // namespace dma
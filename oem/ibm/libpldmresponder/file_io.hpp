@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common/utils.hpp"
+#include "dma_engine.hpp"
 #include "oem/ibm/requester/dbus_to_file_handler.hpp"
 #include "oem_ibm_handler.hpp"
 #include "pldmd/handler.hpp"
@@ -48,6 +49,13 @@ namespace fs = std::filesystem;
 class DMA
 {
   public:
+    /** @brief Constructor
+     *
+     * @param[in] engine - DMA engine doing the transfers, the XDMA device
+     *                     one by default
+     */
+    explicit DMA(DmaEngine& engine = DmaEngine::get()) : engine(engine) {}
+
     /** @brief API to transfer data between BMC and host using DMA
      *
      * @param[in] path     - pathname of the file to transfer data from or to
@@ -71,6 +79,9 @@ class DMA
      * @return returns 0 on success, negative errno on failure
      */
     int transferHostDataToSocket(int fd, uint32_t length, uint64_t address);
+
+  private:
+    DmaEngine& engine;
 };
 
 /** @brief Transfer the data between BMC and host using DMA.
@@ -0,0 +1,161 @@
+#include "libpldmresponder/dma_engine.hpp"
+#include "libpldmresponder/file_io.hpp"
+
+#include <libpldm/base.h>
+#include <libpldm/oem/ibm/file_io.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace fs = std::filesystem;
+using namespace pldm::responder::dma;
+
+class DmaEngineTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        char hostTemplate[] = "/tmp/pldm_dma_host.XXXXXX";
+        hostFd = mkstemp(hostTemplate);
+        hostPath = hostTemplate;
+        char fileTemplate[] = "/tmp/pldm_dma_file.XXXXXX";
+        fileFd = mkstemp(fileTemplate);
+        filePath = fileTemplate;
+    }
+
+    void TearDown() override
+    {
+        close(hostFd);
+        close(fileFd);
+        fs::remove(hostPath);
+        fs::remove(filePath);
+    }
+
+    static std::vector<uint8_t> pattern(size_t size, uint8_t seed)
+    {
+        std::vector<uint8_t> data(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            data[i] = static_cast<uint8_t>(i * 7 + i / 4096 + seed);
+        }
+        return data;
+    }
+
+    static std::vector<uint8_t> readAt(int fd, size_t offset, size_t size)
+    {
+        std::vector<uint8_t> data(size);
+        auto rc = pread(fd, data.data(), size, offset);
+        data.resize(rc < 0 ? 0 : rc);
+        return data;
+    }
+
+    static void writeAt(int fd, const std::vector<uint8_t>& data,
+                        size_t offset)
+    {
+        ASSERT_EQ(pwrite(fd, data.data(), data.size(), offset),
+                  static_cast<ssize_t>(data.size()));
+    }
+
+    int hostFd = -1;
+    int fileFd = -1;
+    fs::path hostPath;
+    fs::path filePath;
+};
+
+TEST_F(DmaEngineTest, upstream)
+{
+    constexpr size_t window = 64 * 1024;
+    auto data = pattern(3 * window, 1);
+    writeAt(fileFd, data, 0);
+
+    auto xdma = std::make_unique<FileXdma>(hostFd, window);
+    auto& backend = *xdma;
+    DmaEngine engine(std::move(xdma));
+
+    /* Chunks of the file to consecutive host addresses */
+    for (uint32_t offset = 0; offset < data.size(); offset += window)
+    {
+        ASSERT_EQ(engine.transferDataHost(fileFd, offset, window,
+                                          0x1000 + offset, true),
+                  0);
+    }
+    EXPECT_EQ(backend.getOperations(), 3);
+    EXPECT_EQ(readAt(hostFd, 0x1000, data.size()), data);
+}
+
+TEST_F(DmaEngineTest, downstream)
+{
+    constexpr size_t window = 64 * 1024;
+    auto data = pattern(window, 2);
+    writeAt(hostFd, data, 0x2000);
+    writeAt(fileFd, pattern(2 * window, 3), 0);
+
+    DmaEngine engine(std::make_unique<FileXdma>(hostFd, window));
+    ASSERT_EQ(engine.transferDataHost(fileFd, 512, window - 1024, 0x2000,
+                                      false),
+              0);
+
+    auto file = readAt(fileFd, 0, 2 * window);
+    auto expected = pattern(2 * window, 3);
+    std::copy(data.begin(), data.begin() + window - 1024,
+              expected.begin() + 512);
+    EXPECT_EQ(file, expected);
+}
+
+TEST_F(DmaEngineTest, badPath)
+{
+    constexpr size_t window = 64 * 1024;
+    writeAt(fileFd, pattern(window, 4), 0);
+    DmaEngine engine(std::make_unique<FileXdma>(hostFd, window));
+
+    /* Larger than the window */
+    EXPECT_EQ(engine.transferDataHost(fileFd, 0, window + 16, 0, true),
+              -EINVAL);
+    /* Past the end of the file */
+    EXPECT_EQ(engine.transferDataHost(fileFd, window - 16, 32, 0, true), -1);
+}
+
+TEST_F(DmaEngineTest, transferAll)
+{
+    auto data = pattern(2 * maxSize + minSize, 5);
+    writeAt(fileFd, data, 0);
+
+    auto xdma = std::make_unique<FileXdma>(hostFd, maxSize);
+    auto& backend = *xdma;
+    DmaEngine engine(std::move(xdma));
+    DMA intf(engine);
+
+    auto response = transferAll<DMA>(&intf, PLDM_READ_FILE_INTO_MEMORY,
+                                     filePath, 0, data.size(), 0, true, 0);
+    auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
+    ASSERT_EQ(responsePtr->payload[0], PLDM_SUCCESS);
+    EXPECT_EQ(backend.getOperations(), 3);
+    EXPECT_EQ(readAt(hostFd, 0, data.size()), data);
+}
+
+TEST_F(DmaEngineTest, throughput)
+{
+    constexpr size_t total = 64 * 1024 * 1024;
+    auto data = pattern(total, 6);
+    writeAt(fileFd, data, 0);
+
+    DmaEngine engine(std::make_unique<FileXdma>(hostFd, maxSize));
+    DMA intf(engine);
+
+    auto start = std::chrono::steady_clock::now();
+    auto response = transferAll<DMA>(&intf, PLDM_READ_FILE_INTO_MEMORY,
+                                     filePath, 0, total, 0, true, 0);
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+    auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
+    ASSERT_EQ(responsePtr->payload[0], PLDM_SUCCESS);
+
+    auto mbPerSec = elapsed.count() ? total / elapsed.count() : 0;
+    RecordProperty("mb_per_sec", std::to_string(mbPerSec));
+}
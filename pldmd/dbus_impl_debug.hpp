@@ -0,0 +1,90 @@
+#pragma once
+
+#include <systemd/sd-bus.h>
+
+#include <sdbusplus/bus.hpp>
+#include <sdbusplus/message.hpp>
+#include <sdbusplus/server/interface.hpp>
+#include <sdbusplus/vtable.hpp>
+
+#include <cerrno>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <map>
+#include <string>
+
+namespace pldm
+{
+namespace dbus_api
+{
+
+/** @class DebugStats
+ *  @brief Read-only debug counters of a pldmd component on D-Bus
+ *  @details Hosts the xyz.openbmc_project.PLDM.Debug interface. Its Counters
+ *  property is a dictionary of counter names to values, collected from the
+ *  owning component each time the property is read, so keeping the counters
+ *  up to date costs nothing on the hot path.
+ */
+class DebugStats
+{
+  public:
+    using Counters = std::map<std::string, uint64_t>;
+    using CountersGetter = std::function<Counters()>;
+
+    static constexpr auto interface = "xyz.openbmc_project.PLDM.Debug";
+    static constexpr auto basePath = "/xyz/openbmc_project/pldm/debug";
+
+    DebugStats() = delete;
+    DebugStats(const DebugStats&) = delete;
+    DebugStats& operator=(const DebugStats&) = delete;
+    DebugStats(DebugStats&&) = delete;
+    DebugStats& operator=(DebugStats&&) = delete;
+    ~DebugStats() = default;
+
+    /** @brief Constructor to put the counters onto bus at a dbus path.
+     *  @param[in] bus - Bus to attach to.
+     *  @param[in] path - Path to attach at.
+     *  @param[in] getter - Collects the counters of the component
+     */
+    DebugStats(sdbusplus::bus_t& bus, const std::string& path,
+               CountersGetter getter) :
+        getter(std::move(getter)),
+        intf(bus, path.c_str(), interface, vtable, this)
+    {}
+
+  private:
+    /** @brief sd-bus callback for the Counters property */
+    static int getCounters(sd_bus* /*bus*/, const char* /*path*/,
+                           const char* /*interface*/,
+                           const char* /*property*/, sd_bus_message* reply,
+                           void* context, sd_bus_error* /*error*/)
+    {
+        auto self = static_cast<DebugStats*>(context);
+        try
+        {
+            auto m = sdbusplus::message_t(reply);
+            m.append(self->getter());
+        }
+        catch (const std::exception& e)
+        {
+            return -EINVAL;
+        }
+
+        return 1;
+    }
+
+    inline static const sdbusplus::vtable_t vtable[] = {
+        sdbusplus::vtable::start(),
+        sdbusplus::vtable::property("Counters", "a{st}", getCounters),
+        sdbusplus::vtable::end()};
+
+    /** @brief Collects the counters of the component */
+    CountersGetter getter;
+
+    /** @brief The D-Bus interface holding the Counters property */
+    sdbusplus::server::interface_t intf;
+};
+
+} // namespace dbus_api
+} // namespace pldm
@@ -3,6 +3,7 @@
 #include "common/instance_id.hpp"
 #include "common/transport.hpp"
 #include "common/utils.hpp"
+#include "dbus_impl_debug.hpp"
 #include "dbus_impl_requester.hpp"
 #include "fw-update/manager.hpp"
 #include "invoker.hpp"
@@ -37,6 +38,7 @@
 #include <iterator>
 #include <memory>
 #include <ranges>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -84,13 +86,24 @@ void interruptFlightRecorderCallBack(Signal& /*signal*/,
     FlightRecorder::GetInstance().playRecorder();
 }
 
+/** @brief Dispatch a received message to the responder or requester handlers
+ *
+ *  The message is a view over the receive buffer, handlers copy the bytes
+ *  only when they need to keep them.
+ */
 static std::optional<Response>
-    processRxMsg(const std::vector<uint8_t>& requestMsg, Invoker& invoker,
+    processRxMsg(std::span<const uint8_t> requestMsg, Invoker& invoker,
                  requester::Handler<requester::Request>& handler,
                  fw_update::Manager* fwManager, pldm_tid_t tid)
 {
     uint8_t eid = tid;
 
+    if (requestMsg.size() < sizeof(struct pldm_msg_hdr))
+    {
+        error("Received PLDM message shorter than the PLDM header");
+        return std::nullopt;
+    }
+
     pldm_header_info hdrFields{};
     auto hdr = reinterpret_cast<const pldm_msg_hdr*>(requestMsg.data());
     if (PLDM_SUCCESS != unpack_pldm_header(hdr, &hdrFields))
@@ -296,6 +309,13 @@ int main(int argc, char** argv)
                              size_t eventDataOffset) {
              return eventManager->handleSensorEvent(
                  request, payloadLength, formatVersion, tid, eventDataOffset);
+         }}},
+        {PLDM_PDR_REPOSITORY_CHG_EVENT,
+         {[&eventManager](const pldm_msg* request, size_t payloadLength,
+                             uint8_t formatVersion, uint8_t tid,
+                             size_t eventDataOffset) {
+             return eventManager->handlePDRRepositoryChgEvent(
+                 request, payloadLength, formatVersion, tid, eventDataOffset);
          }}}};
 
     auto platformHandler = std::make_unique<platform::Handler>(
@@ -342,61 +362,78 @@ int main(int argc, char** argv)
             return;
         }
 
-        int returnCode = 0;
-        void* requestMsg;
-        size_t recvDataLength;
-        returnCode = pldmTransport.recvMsg(TID, requestMsg, recvDataLength);
+        // The source is level triggered, messages left over once the budget
+        // is spent are handled on the next wakeup
+        pldm::utils::drainReadyMessages(fd, RX_MESSAGE_BUDGET, [&]() {
+            PldmRxBuffer requestMsg(nullptr);
+            size_t recvDataLength = 0;
+            int returnCode = pldmTransport.recvMsg(TID, requestMsg,
+                                                   recvDataLength);
 
-        if (returnCode == PLDM_REQUESTER_SUCCESS)
-        {
-            std::vector<uint8_t> requestMsgVec(
-                static_cast<uint8_t*>(requestMsg),
-                static_cast<uint8_t*>(requestMsg) + recvDataLength);
-            FlightRecorder::GetInstance().saveRecord(requestMsgVec, false);
-            if (verbose)
-            {
-                printBuffer(Rx, requestMsgVec);
-            }
-            // process message and send response
-            auto response = processRxMsg(requestMsgVec, invoker, reqHandler,
-                                         fwManager.get(), TID);
-            if (response.has_value())
+            if (returnCode == PLDM_REQUESTER_SUCCESS)
             {
-                FlightRecorder::GetInstance().saveRecord(*response, true);
+                // The message stays in the transport buffer, which is freed
+                // when requestMsg goes out of scope
+                std::span<const uint8_t> rxMsg(requestMsg.get(),
+                                               recvDataLength);
+                FlightRecorder::GetInstance().saveRecord(rxMsg, false);
                 if (verbose)
                 {
-                    printBuffer(Tx, *response);
+                    printBuffer(Rx, rxMsg);
                 }
-
-                returnCode = pldmTransport.sendMsg(TID, (*response).data(),
-                                                   (*response).size());
-                if (returnCode != PLDM_REQUESTER_SUCCESS)
+                // process message and send response
+                auto response = processRxMsg(rxMsg, invoker, reqHandler,
+                                             fwManager.get(), TID);
+                if (response.has_value())
                 {
-                    warning("Failed to send PLDM response: {RETURN_CODE}",
-                            "RETURN_CODE", returnCode);
+                    FlightRecorder::GetInstance().saveRecord(*response, true);
+                    if (verbose)
+                    {
+                        printBuffer(Tx, *response);
+                    }
+
+                    returnCode = pldmTransport.sendMsg(
+                        TID, (*response).data(), (*response).size());
+                    if (returnCode != PLDM_REQUESTER_SUCCESS)
+                    {
+                        warning("Failed to send PLDM response: {RETURN_CODE}",
+                                "RETURN_CODE", returnCode);
+                    }
                 }
             }
-        }
-        // TODO check that we get here if mctp-demux dies?
-        else if (returnCode == PLDM_REQUESTER_RECV_FAIL)
-        {
-            // MCTP daemon has closed the socket this daemon is connected to.
-            // This may or may not be an error scenario, in either case the
-            // recovery mechanism for this daemon is to restart, and hence exit
-            // the event loop, that will cause this daemon to exit with a
-            // failure code.
-            error("io exiting");
-            io.get_event().exit(0);
-        }
-        else
-        {
-            warning("Failed to receive PLDM request: {RETURN_CODE}",
-                    "RETURN_CODE", returnCode);
-        }
+            // TODO check that we get here if mctp-demux dies?
+            else if (returnCode == PLDM_REQUESTER_RECV_FAIL)
+            {
+                // MCTP daemon has closed the socket this daemon is connected
+                // to. This may or may not be an error scenario, in either
+                // case the recovery mechanism for this daemon is to restart,
+                // and hence exit the event loop, that will cause this daemon
+                // to exit with a failure code.
+                error("io exiting");
+                io.get_event().exit(0);
+                return false;
+            }
+            else
+            {
+                warning("Failed to receive PLDM request: {RETURN_CODE}",
+                        "RETURN_CODE", returnCode);
+            }
+            return true;
+        });
     };
 
     bus.attach_event(event.get(), SD_EVENT_PRIORITY_NORMAL);
     bus.request_name("xyz.openbmc_project.PLDM");
+    DBusHandler::enableServiceCache();
+    dbus_api::DebugStats dbusServiceCacheStats(
+        bus,
+        std::string(dbus_api::DebugStats::basePath) + "/dbus_service_cache",
+        []() -> dbus_api::DebugStats::Counters {
+        const auto& cache = DBusHandler::getServiceCache();
+        return {{"Hits", cache.getHits()},
+                {"Misses", cache.getMisses()},
+                {"Entries", cache.size()}};
+    });
     IO io(event, pldmTransport.getEventSource(), EPOLLIN, std::move(callback));
 #ifdef LIBPLDMRESPONDER
     if (hostPDRHandler)
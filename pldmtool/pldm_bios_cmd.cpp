@@ -195,48 +195,67 @@ class GetBIOSTableHandler : public CommandInterface
 
     std::optional<Table> getBIOSTable(pldm_bios_table_types tableType)
     {
-        std::vector<uint8_t> requestMsg(sizeof(pldm_msg_hdr) +
-                                        PLDM_GET_BIOS_TABLE_REQ_BYTES);
-        auto request = reinterpret_cast<pldm_msg*>(requestMsg.data());
+        Table table;
+        uint32_t transferHandle = 0;
+        uint8_t transferOpFlag = PLDM_GET_FIRSTPART;
 
-        auto rc = encode_get_bios_table_req(instanceId, 0, PLDM_GET_FIRSTPART,
-                                            tableType, request);
-        if (rc != PLDM_SUCCESS)
-        {
-            std::cerr << "Encode GetBIOSTable Error, tableType=," << tableType
-                      << " ,rc=" << rc << std::endl;
-            return std::nullopt;
-        }
-        std::vector<uint8_t> responseMsg;
-        rc = pldmSendRecv(requestMsg, responseMsg);
-        if (rc != PLDM_SUCCESS)
+        // Large tables are transferred in multiple parts
+        while (true)
         {
-            std::cerr << "PLDM: Communication Error, rc =" << rc << std::endl;
-            return std::nullopt;
-        }
+            std::vector<uint8_t> requestMsg(sizeof(pldm_msg_hdr) +
+                                            PLDM_GET_BIOS_TABLE_REQ_BYTES);
+            auto request = reinterpret_cast<pldm_msg*>(requestMsg.data());
 
-        uint8_t cc = 0, transferFlag = 0;
-        uint32_t nextTransferHandle = 0;
-        size_t bios_table_offset;
-        auto responsePtr =
-            reinterpret_cast<struct pldm_msg*>(responseMsg.data());
-        auto payloadLength = responseMsg.size() - sizeof(pldm_msg_hdr);
+            auto rc = encode_get_bios_table_req(instanceId, transferHandle,
+                                                transferOpFlag, tableType,
+                                                request);
+            if (rc != PLDM_SUCCESS)
+            {
+                std::cerr << "Encode GetBIOSTable Error, tableType=,"
+                          << tableType << " ,rc=" << rc << std::endl;
+                return std::nullopt;
+            }
+            std::vector<uint8_t> responseMsg;
+            rc = pldmSendRecv(requestMsg, responseMsg);
+            if (rc != PLDM_SUCCESS)
+            {
+                std::cerr << "PLDM: Communication Error, rc =" << rc
+                          << std::endl;
+                return std::nullopt;
+            }
 
-        rc = decode_get_bios_table_resp(responsePtr, payloadLength, &cc,
-                                        &nextTransferHandle, &transferFlag,
-                                        &bios_table_offset);
+            uint8_t cc = 0, transferFlag = 0;
+            uint32_t nextTransferHandle = 0;
+            size_t bios_table_offset;
+            auto responsePtr =
+                reinterpret_cast<struct pldm_msg*>(responseMsg.data());
+            auto payloadLength = responseMsg.size() - sizeof(pldm_msg_hdr);
 
-        if (rc != PLDM_SUCCESS || cc != PLDM_SUCCESS)
-        {
-            std::cerr << "GetBIOSTable Response Error: tableType=" << tableType
-                      << ", rc=" << rc << ", cc=" << (int)cc << std::endl;
-            return std::nullopt;
+            rc = decode_get_bios_table_resp(responsePtr, payloadLength, &cc,
+                                            &nextTransferHandle, &transferFlag,
+                                            &bios_table_offset);
+
+            if (rc != PLDM_SUCCESS || cc != PLDM_SUCCESS)
+            {
+                std::cerr << "GetBIOSTable Response Error: tableType="
+                          << tableType << ", rc=" << rc << ", cc=" << (int)cc
+                          << std::endl;
+                return std::nullopt;
+            }
+            auto tableData = responsePtr->payload + bios_table_offset;
+            auto tableSize = payloadLength - sizeof(nextTransferHandle) -
+                             sizeof(transferFlag) - sizeof(cc);
+            table.insert(table.end(), tableData, tableData + tableSize);
+
+            if (transferFlag != PLDM_START && transferFlag != PLDM_MIDDLE)
+            {
+                break;
+            }
+            transferHandle = nextTransferHandle;
+            transferOpFlag = PLDM_GET_NEXTPART;
         }
-        auto tableData =
-            reinterpret_cast<char*>((responsePtr->payload) + bios_table_offset);
-        auto tableSize = payloadLength - sizeof(nextTransferHandle) -
-                         sizeof(transferFlag) - sizeof(cc);
-        return std::make_optional<Table>(tableData, tableData + tableSize);
+
+        return table;
     }
 
     const pldm_bios_attr_table_entry*
@@ -418,7 +418,7 @@ class GetFruRecordTable : public CommandInterface
         auto request = reinterpret_cast<pldm_msg*>(requestMsg.data());
 
         auto rc = encode_get_fru_record_table_req(
-            instanceId, 0, PLDM_GET_FIRSTPART, request,
+            instanceId, transferHandle, transferOpFlag, request,
             requestMsg.size() - sizeof(pldm_msg_hdr));
         return {rc, requestMsg};
     }
@@ -442,10 +442,45 @@ class GetFruRecordTable : public CommandInterface
             return;
         }
 
-        FRUTablePrint tablePrint(fru_record_table_data.data(),
-                                 fru_record_table_length);
+        table.insert(table.end(), fru_record_table_data.begin(),
+                     fru_record_table_data.begin() + fru_record_table_length);
+        transferHandle = next_data_transfer_handle;
+        transferFlag = transfer_flag;
+        partReceived = true;
+    }
+
+    void exec() override
+    {
+        transferHandle = 0;
+        transferOpFlag = PLDM_GET_FIRSTPART;
+        table.clear();
+
+        // Large tables are transferred in multiple parts
+        while (true)
+        {
+            partReceived = false;
+            CommandInterface::exec();
+            if (!partReceived)
+            {
+                return;
+            }
+            if (transferFlag != PLDM_START && transferFlag != PLDM_MIDDLE)
+            {
+                break;
+            }
+            transferOpFlag = PLDM_GET_NEXTPART;
+        }
+
+        FRUTablePrint tablePrint(table.data(), table.size());
         tablePrint.print();
     }
+
+  private:
+    uint32_t transferHandle = 0;
+    uint8_t transferOpFlag = PLDM_GET_FIRSTPART;
+    uint8_t transferFlag = 0;
+    bool partReceived = false;
+    std::vector<uint8_t> table;
 };
 
 void registerCommand(CLI::App& app)
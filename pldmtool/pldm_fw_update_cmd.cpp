@@ -2,9 +2,13 @@
 
 #include "common/utils.hpp"
 #include "pldm_cmd_helper.hpp"
+#include "pldmd/dbus_impl_debug.hpp"
 
 #include <libpldm/firmware_update.h>
 
+#include <map>
+#include <variant>
+
 namespace pldmtool
 {
 
@@ -611,6 +615,42 @@ void QueryDeviceIdentifiers::parseResponseMsg(pldm_msg* responsePtr,
     pldmtool::helper::DisplayInJson(data);
 }
 
+/** @brief Display the firmware transfer counters pldmd keeps on the Activation
+ *         objects of the packages being updated
+ */
+void getTransferStats()
+{
+    using pldm::dbus_api::DebugStats;
+    ordered_json data;
+    try
+    {
+        auto& bus = pldm::utils::DBusHandler::getBus();
+        auto objects = pldm::utils::DBusHandler().getSubtree(
+            "/xyz/openbmc_project/software", 0, {DebugStats::interface});
+        for (const auto& [path, services] : objects)
+        {
+            for (const auto& [service, interfaces] : services)
+            {
+                auto method = bus.new_method_call(
+                    service.c_str(), path.c_str(),
+                    "org.freedesktop.DBus.Properties", "Get");
+                method.append(DebugStats::interface, "Counters");
+                auto reply = bus.call(method);
+                std::variant<DebugStats::Counters> counters;
+                reply.read(counters);
+                data[path] = std::get<DebugStats::Counters>(counters);
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Failed to read the firmware transfer counters, ERROR="
+                  << e.what() << "\n";
+        return;
+    }
+    pldmtool::helper::DisplayInJson(data);
+}
+
 void registerCommand(CLI::App& app)
 {
     auto fwUpdate = app.add_subcommand("fw_update",
@@ -630,6 +670,11 @@ void registerCommand(CLI::App& app)
         "QueryDeviceIdentifiers", "To query device identifiers of the FD");
     commands.push_back(std::make_unique<QueryDeviceIdentifiers>(
         "fw_update", "QueryDeviceIdentifiers", queryDeviceIdentifiers));
+
+    auto transferStats = fwUpdate->add_subcommand(
+        "GetTransferStats",
+        "Firmware transfer counters of the packages being activated");
+    transferStats->callback([]() { getTransferStats(); });
 }
 
 } // namespace fw_update
@@ -1,8 +1,11 @@
 #include "cper.hpp"
 #include "common/utils.hpp"
 #include <string.h>
+#include <algorithm>
+#include <array>
+#include <functional>
 #include <iostream>
-#include <map>
+#include <unordered_map>
 #include <vector>
 #include <cstring>
 /*
@@ -27,97 +30,147 @@ Guid CPER_SEC_PCIE =  { 0xd995e954, 0xbbc1, 0x430f, \
 Guid CPER_AMPERE_SPECIFIC = { 0x2826cc9f, 0x448c, 0x4c2b, \
                  { 0x86, 0xb6, 0xa9, 0x53, 0x94, 0xb7, 0xef, 0x33 }};
 
-std::map<uint16_t, size_t> armProcCtxMap = {
-        {ARM_CONTEXT_TYPE_AARCH32_GPR, sizeof(ARM_V8_AARCH32_GPR)},
-        {ARM_CONTEXT_TYPE_AARCH32_EL1, sizeof(ARM_AARCH32_EL1_CONTEXT_REGISTERS)},
-        {ARM_CONTEXT_TYPE_AARCH32_EL2, sizeof(ARM_AARCH32_EL2_CONTEXT_REGISTERS)},
-        {ARM_CONTEXT_TYPE_AARCH32_SECURE, sizeof(ARM_AARCH32_SECURE_CONTEXT_REGISTERS)},
-        {ARM_CONTEXT_TYPE_AARCH64_GPR, sizeof(ARM_V8_AARCH64_GPR)},
-        {ARM_CONTEXT_TYPE_AARCH64_EL1, sizeof(ARM_AARCH64_EL1_CONTEXT_REGISTERS)},
-        {ARM_CONTEXT_TYPE_AARCH64_EL2, sizeof(ARM_AARCH64_EL2_CONTEXT_REGISTERS)},
-        {ARM_CONTEXT_TYPE_AARCH64_EL3, sizeof(ARM_AARCH64_EL3_CONTEXT_REGISTERS)},
-        {ARM_CONTEXT_TYPE_MISC, sizeof(ARM_MISC_CONTEXT_REGISTER)},
+/* Size of the register array of each ARM context type, indexed by type */
+static constexpr std::array<size_t, ARM_CONTEXT_TYPE_MISC + 1> armProcCtxSize =
+{
+        sizeof(ARM_V8_AARCH32_GPR),
+        sizeof(ARM_AARCH32_EL1_CONTEXT_REGISTERS),
+        sizeof(ARM_AARCH32_EL2_CONTEXT_REGISTERS),
+        sizeof(ARM_AARCH32_SECURE_CONTEXT_REGISTERS),
+        sizeof(ARM_V8_AARCH64_GPR),
+        sizeof(ARM_AARCH64_EL1_CONTEXT_REGISTERS),
+        sizeof(ARM_AARCH64_EL2_CONTEXT_REGISTERS),
+        sizeof(ARM_AARCH64_EL3_CONTEXT_REGISTERS),
+        sizeof(ARM_MISC_CONTEXT_REGISTER),
 };
 
-//Returns one if two EFI GUIDs are equal, zero otherwise.
-static inline bool guidEqual(Guid *a, Guid *b)
+struct GuidHash
 {
-    //Check top base 3 components.
-    if (a->Data1 != b->Data1 || a->Data2 != b->Data2 ||
-        a->Data3 != b->Data3) {
-        return false;
+    size_t operator()(const Guid &guid) const
+    {
+        uint64_t data4;
+        std::memcpy(&data4, guid.Data4, sizeof(data4));
+        return std::hash<uint64_t>{}(
+            ((uint64_t)guid.Data1 << 32 | (uint64_t)guid.Data2 << 16 |
+             guid.Data3) ^ data4);
     }
+};
 
-    //Check Data4 array for equality.
-    for (int i = 0; i < 8; i++) {
-        if (a->Data4[i] != b->Data4[i])
-            return false;
+struct GuidEqual
+{
+    bool operator()(const Guid &a, const Guid &b) const
+    {
+        return std::memcmp(&a, &b, sizeof(Guid)) == 0;
     }
+};
 
-    return true;
+static void append(std::vector<uint8_t> &out, const uint8_t *data, size_t len)
+{
+    out.insert(out.end(), data, data + len);
 }
 
-static void decodeSecAmpere(void *section, uint32_t len,
-                            AmpereSpecData* ampSpecHdr,
-                            std::ofstream &out)
+/*
+ * Section decoders. Each one gets the section as described by its section
+ * descriptor, already checked to be within the record, and returns -1 if
+ * the section is too short for what it describes.
+ */
+using SectionDecoder = int (*)(std::span<const uint8_t> section,
+                               AmpereSpecData* ampSpecHdr,
+                               std::vector<uint8_t> &out);
+
+static int decodeSecAmpere(std::span<const uint8_t> section,
+                           AmpereSpecData* ampSpecHdr,
+                           std::vector<uint8_t> &out)
 {
-    std::memcpy(ampSpecHdr, section, sizeof(AmpereSpecData));
-    out.write((char*)section, len);
+    if (section.size() < sizeof(AmpereSpecData))
+    {
+        return -1;
+    }
+    std::memcpy(ampSpecHdr, section.data(), sizeof(AmpereSpecData));
+    append(out, section.data(), section.size());
+    return 0;
 }
 
-static void decodeSecArm(void *section, AmpereSpecData* ampSpecHdr,
-                         std::ofstream &out)
+static int decodeSecArm(std::span<const uint8_t> section,
+                        AmpereSpecData* ampSpecHdr,
+                        std::vector<uint8_t> &out)
 {
-    int i, len;
-    CPERSecProcArm *proc;
-    CPERArmErrInfo *errInfo;
-    CPERArmCtxInfo *ctxInfo;
+    CPERSecProcArm proc;
+    size_t pos;
 
-    proc = (CPERSecProcArm*) section;
-    out.write((char*)section, sizeof(CPERSecProcArm));
-    errInfo = (CPERArmErrInfo *)(proc + 1);
-    out.write((char*) errInfo, proc->ErrInfoNum * sizeof(CPERArmErrInfo));
-    len = proc->SectionLength - (sizeof(CPERSecProcArm) +
-          proc->ErrInfoNum * (sizeof(CPERArmErrInfo)));
-    if (len < 0)
+    if (section.size() < sizeof(CPERSecProcArm))
     {
-        std::cerr << "section length is too small : " << proc->SectionLength
+        return -1;
+    }
+    std::memcpy(&proc, section.data(), sizeof(CPERSecProcArm));
+    pos = sizeof(CPERSecProcArm) +
+          (size_t)proc.ErrInfoNum * sizeof(CPERArmErrInfo);
+    if (pos > section.size() || proc.SectionLength < pos ||
+        proc.SectionLength > section.size())
+    {
+        std::cerr << "section length is too small : " << proc.SectionLength
                   << "\n";
+        return -1;
     }
+    append(out, section.data(), pos);
 
-    ctxInfo = (CPERArmCtxInfo *)(errInfo + proc->ErrInfoNum);
-    for (i = 0; i < proc->ContextInfoNum; i++) {
-        out.write((char*) ctxInfo, sizeof(CPERArmCtxInfo));
-        out.write((char*)(ctxInfo + 1), armProcCtxMap[ctxInfo->RegisterContextType]);
-        int size = sizeof(CPERArmCtxInfo) + ctxInfo->RegisterArraySize;
-        len -= size;
-        ctxInfo = (CPERArmCtxInfo *)((long)ctxInfo + size);
+    for (int i = 0; i < proc.ContextInfoNum; i++) {
+        CPERArmCtxInfo ctxInfo;
+        if (proc.SectionLength - pos < sizeof(CPERArmCtxInfo))
+        {
+            return -1;
+        }
+        std::memcpy(&ctxInfo, &section[pos], sizeof(CPERArmCtxInfo));
+        size_t regSize = ctxInfo.RegisterContextType < armProcCtxSize.size() ?
+                         armProcCtxSize[ctxInfo.RegisterContextType] : 0;
+        size_t size = sizeof(CPERArmCtxInfo) + ctxInfo.RegisterArraySize;
+        if (proc.SectionLength - pos < size ||
+            proc.SectionLength - pos < sizeof(CPERArmCtxInfo) + regSize)
+        {
+            return -1;
+        }
+        append(out, &section[pos], sizeof(CPERArmCtxInfo) + regSize);
+        pos += size;
     }
 
-    if (len > 0) {
+    if (proc.SectionLength > pos) {
         /* Get Ampere Specific header data */
-        std::memcpy(ampSpecHdr, (void*) ctxInfo, sizeof(AmpereSpecData));
-        out.write((char*) ctxInfo, len);
+        std::memcpy(ampSpecHdr, &section[pos],
+                    std::min(sizeof(AmpereSpecData),
+                             (size_t)proc.SectionLength - pos));
+        append(out, &section[pos], proc.SectionLength - pos);
     }
+    return 0;
 }
 
-static void decodeSecPlatformMemory(void *section, AmpereSpecData* ampSpecHdr,
-                                    std::ofstream &out)
+static int decodeSecPlatformMemory(std::span<const uint8_t> section,
+                                   AmpereSpecData* ampSpecHdr,
+                                   std::vector<uint8_t> &out)
 {
-    CPERSecMemErr *mem = (CPERSecMemErr*) section;
-    out.write((char*)section, sizeof(CPERSecMemErr));
+    if (section.size() < sizeof(CPERSecMemErr))
+    {
+        return -1;
+    }
+    auto mem = reinterpret_cast<const CPERSecMemErr*>(section.data());
+    append(out, section.data(), sizeof(CPERSecMemErr));
     if (mem->ErrorType == MEM_ERROR_TYPE_PARITY)
     {
         ampSpecHdr->typeId.member.ipType = ERROR_TYPE_ID_MCU;
         ampSpecHdr->subTypeId = SUBTYPE_ID_PARITY;
     }
+    return 0;
 }
 
-static void decodeSecPcie(void *section, AmpereSpecData* ampSpecHdr,
-                          std::ofstream &out)
+static int decodeSecPcie(std::span<const uint8_t> section,
+                         AmpereSpecData* ampSpecHdr,
+                         std::vector<uint8_t> &out)
 {
-    CPERSecPcieErr *pcieErr = (CPERSecPcieErr*) section;
-    out.write((char*)section, sizeof(CPERSecPcieErr));
+    if (section.size() < sizeof(CPERSecPcieErr))
+    {
+        return -1;
+    }
+    auto pcieErr = reinterpret_cast<const CPERSecPcieErr*>(section.data());
+    append(out, section.data(), sizeof(CPERSecPcieErr));
     if (pcieErr->ValidFields & CPER_PCIE_VALID_PORT_TYPE)
     {
         if (pcieErr->PortType == CPER_PCIE_PORT_TYPE_ROOT_PORT)
@@ -129,89 +182,97 @@ static void decodeSecPcie(void *section, AmpereSpecData* ampSpecHdr,
             ampSpecHdr->subTypeId = ERROR_SUBTYPE_PCIE_AER_DEVICE;
         }
     }
-
+    return 0;
 }
 
-static void decodeCperSection(std::vector<uint8_t> &data, long basePos,
-                              AmpereSpecData* ampSpecHdr,
-                              CPERSectionDescriptor *secDesc,
-                              std::ofstream &out)
+static const std::unordered_map<Guid, SectionDecoder, GuidHash, GuidEqual>
+    sectionDecoders = {
+        {CPER_AMPERE_SPECIFIC, decodeSecAmpere},
+        {CPER_SEC_PROC_ARM, decodeSecArm},
+        {CPER_SEC_PLATFORM_MEM, decodeSecPlatformMemory},
+        {CPER_SEC_PCIE, decodeSecPcie},
+};
+
+int decodeCperRecord(std::span<const uint8_t> data,
+                     AmpereSpecData* ampSpecHdr,
+                     std::vector<uint8_t> &out)
 {
-    long pos;
+    CPERRecodHeader cperHeader;
 
-    //Read section as described by the section descriptor.
-    pos = basePos + secDesc->SectionOffset;
-    char *section = new char[secDesc->SectionLength];
-    std::memcpy(section, &data[pos], secDesc->SectionLength);
-    pos += secDesc->SectionLength;
-    Guid *ptr = (Guid *) &secDesc->SectionType;
-    if (guidEqual(ptr, &CPER_AMPERE_SPECIFIC))
-    {
-        std::cout << "RAS Section Type : Ampere Specific\n";
-        decodeSecAmpere(section, secDesc->SectionLength, ampSpecHdr, out);
-    }
-    else if (guidEqual(ptr, &CPER_SEC_PROC_ARM))
-    {
-        std::cout << "RAS Section Type : ARM\n";
-        decodeSecArm(section, ampSpecHdr, out);
-    }
-    else if (guidEqual(ptr, &CPER_SEC_PLATFORM_MEM))
-    {
-        std::cout << "RAS Section Type : Memory\n";
-        decodeSecPlatformMemory(section, ampSpecHdr, out);
-    }
-    else if (guidEqual(ptr, &CPER_SEC_PCIE))
+    if (data.size() < sizeof(CPERRecodHeader))
     {
-        std::cout << "RAS Section Type : PCIE\n";
-        decodeSecPcie(section, ampSpecHdr, out);
+        std::cerr << "CPER record too short, size " << data.size() << "\n";
+        return -1;
     }
-    else
+    std::memcpy(&cperHeader, data.data(), sizeof(CPERRecodHeader));
+
+    size_t descEnd = sizeof(CPERRecodHeader) +
+                     (size_t)cperHeader.SectionCount *
+                         sizeof(CPERSectionDescriptor);
+    if (cperHeader.RecordLength < descEnd ||
+        cperHeader.RecordLength > data.size())
     {
-        std::cerr << "Section Type: " << std::hex << ptr->Data1 << "-"
-                  << ptr->Data2 << "-" << ptr->Data3 << "-"
-                  << *(uint64_t*)ptr->Data4
-                  << "not support\n";
+        std::cerr << "Invalid CPER RecordLength " << cperHeader.RecordLength
+                  << ", " << cperHeader.SectionCount << " sections in "
+                  << data.size() << " bytes\n";
+        return -1;
     }
-
-    delete[] section;
-}
-
-void decodeCperRecord(std::vector<uint8_t> &data, long pos,
-                      AmpereSpecData* ampSpecHdr,
-                      std::ofstream &out)
-{
-    CPERRecodHeader cperHeader;
-    int i;
-    long basePos = pos;
-
-    std::memcpy(&cperHeader, &data[pos], sizeof(CPERRecodHeader));
-    pos += sizeof(CPERRecodHeader);
+    auto record = data.first(cperHeader.RecordLength);
 
     //Revert 4 bytes of SignatureStart
     char *sigStr = (char *) &cperHeader.SignatureStart;
-    char tmp;
-    tmp = sigStr[0];
-    sigStr[0] = sigStr[3];
-    sigStr[3] = tmp;
-    tmp = sigStr[1];
-    sigStr[1] = sigStr[2];
-    sigStr[2] = tmp;
+    std::swap(sigStr[0], sigStr[3]);
+    std::swap(sigStr[1], sigStr[2]);
+
+    /* The decoded record is never larger than the record, except for ARM
+     * context registers shorter than their type, so reserve once.
+     */
+    out.clear();
+    out.reserve(record.size());
+    append(out, (const uint8_t*) &cperHeader, sizeof(CPERRecodHeader));
+    append(out, &record[sizeof(CPERRecodHeader)],
+           descEnd - sizeof(CPERRecodHeader));
 
-    out.write((char*) &cperHeader, sizeof(CPERRecodHeader));
+    for (int i = 0; i < cperHeader.SectionCount; i++) {
+        CPERSectionDescriptor secDesc;
+        std::memcpy(&secDesc,
+                    &record[sizeof(CPERRecodHeader) +
+                            i * sizeof(CPERSectionDescriptor)],
+                    sizeof(CPERSectionDescriptor));
 
-    CPERSectionDescriptor *secDesc =
-            new CPERSectionDescriptor[cperHeader.SectionCount];
-    for (i = 0; i < cperHeader.SectionCount; i++) {
-        std::memcpy(&secDesc[i], &data[pos], sizeof(CPERSectionDescriptor));
-        pos += sizeof(CPERSectionDescriptor);
-        out.write((char*) &secDesc[i], sizeof(CPERSectionDescriptor));
-    }
+        const Guid &type = secDesc.SectionType;
+        if ((uint64_t)secDesc.SectionOffset + secDesc.SectionLength >
+            record.size())
+        {
+            std::cerr << "CPER section " << i << " out of the record, offset "
+                      << secDesc.SectionOffset << " length "
+                      << secDesc.SectionLength << "\n";
+            continue;
+        }
+
+        auto decoder = sectionDecoders.find(type);
+        if (decoder == sectionDecoders.end())
+        {
+            uint64_t data4;
+            std::memcpy(&data4, type.Data4, sizeof(data4));
+            std::cerr << "Section Type: " << std::hex << type.Data1 << "-"
+                      << type.Data2 << "-" << type.Data3 << "-" << data4
+                      << std::dec << " not support\n";
+            continue;
+        }
 
-    for (i = 0; i < cperHeader.SectionCount; i++) {
-        decodeCperSection(data, basePos, ampSpecHdr, &secDesc[i], out);
+        auto mark = out.size();
+        if (decoder->second(record.subspan(secDesc.SectionOffset,
+                                           secDesc.SectionLength),
+                            ampSpecHdr, out) < 0)
+        {
+            std::cerr << "CPER section " << i << " too short, length "
+                      << secDesc.SectionLength << "\n";
+            out.resize(mark);
+        }
     }
 
-    delete[] secDesc;
+    return 0;
 }
 
 void addCperSELLog(uint8_t TID, uint16_t eventID, AmpereSpecData *p)
@@ -4,7 +4,7 @@
 #include <stdint.h>
 #include <unistd.h>
 #include <stdio.h>
-#include <fstream>
+#include <span>
 #include <vector>
 
 #define CPER_LOG_DIR               "/usr/share/pldm/cper/"
@@ -412,9 +412,17 @@ typedef struct {
 /*                               Common Header                                */
 /*----------------------------------------------------------------------------*/
 
-void decodeCperRecord(std::vector<uint8_t> &data, long pos,
-                      AmpereSpecData* ampSpecHdr,
-                      std::ofstream &out);
+/*
+ * Decode a CPER record in one pass, looking up the decoder of each section
+ * by its type. The record header, section descriptors and decoded sections
+ * are appended to out, which is cleared first. Sections out of the record,
+ * too short or of an unknown type are skipped.
+ *
+ * Returns -1 if the header or RecordLength is invalid, 0 otherwise.
+ */
+int decodeCperRecord(std::span<const uint8_t> data,
+                     AmpereSpecData* ampSpecHdr,
+                     std::vector<uint8_t> &out);
 void addCperSELLog(uint8_t TID, uint16_t eventID, AmpereSpecData *p);
 
 #endif /* PLDM_COMMON_CPER_HPP_ */
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "common/crc32.hpp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace pldm
+{
+
+/** @class EventDataReassembly
+ *
+ *  Reassembles the event data of a PollForPlatformEventMessage multipart
+ *  transfer. The data transfer handle the terminus returns for the next part
+ *  is the offset of that part in the event data, so each part is appended in
+ *  place and added to a running CRC-32, leaving the integrity check of the
+ *  last part a comparison instead of a pass over the whole event data.
+ *  The buffer keeps its capacity across events.
+ */
+class EventDataReassembly
+{
+  public:
+    /** @brief Start a new event
+     *
+     *  @param[in] expectedSize - size of the event data if known, to size the
+     *                            buffer once
+     */
+    void reset(size_t expectedSize = 0)
+    {
+        buffer.clear();
+        buffer.reserve(expectedSize);
+        crc.reset();
+    }
+
+    /** @brief Add a part of the event data
+     *
+     *  @param[in] offset - offset of the part, the data transfer handle it
+     *                      was requested with
+     *  @param[in] part - event data of the part
+     *
+     *  @return false if the part leaves a gap in the event data
+     */
+    bool append(uint32_t offset, std::span<const uint8_t> part)
+    {
+        if (offset > buffer.size())
+        {
+            return false;
+        }
+        if (offset < buffer.size())
+        {
+            /* The part was received again, drop what followed it */
+            buffer.resize(offset);
+            crc.reset();
+            crc.update(buffer);
+        }
+        buffer.insert(buffer.end(), part.begin(), part.end());
+        crc.update(part);
+        return true;
+    }
+
+    /** @brief Get the CRC-32 of the event data received so far */
+    uint32_t checksum() const
+    {
+        return crc.value();
+    }
+
+    /** @brief Get the event data received so far */
+    const std::vector<uint8_t>& data() const
+    {
+        return buffer;
+    }
+
+    /** @brief Get the size of the event data received so far */
+    size_t size() const
+    {
+        return buffer.size();
+    }
+
+  private:
+    std::vector<uint8_t> buffer;
+    pldm::utils::Crc32 crc;
+};
+
+} // namespace pldm
@@ -7,7 +7,10 @@
 #include "common/instance_id.hpp"
 #include "common/types.hpp"
 #include "common/utils.hpp"
+#include "requester/event_data_reassembly.hpp"
 #include "requester/handler.hpp"
+#include "requester/ras_event_scheduler.hpp"
+#include "pldmd/dbus_impl_debug.hpp"
 
 #include <sdbusplus/timer.hpp>
 #include <sdeventplus/event.hpp>
@@ -47,11 +50,7 @@ class EventHandlerInterface
     void stopEventSignalPolling();
     bool areBMCRASQueuesEmpty()
     {
-      if (critEventQueue.empty() && overflowEventQueue.empty())
-      {
-          return true;
-      }
-      return false;
+      return rasEvents.empty();
     }
 
     bool areMProRASQueuesEmpty()
@@ -60,7 +59,7 @@ class EventHandlerInterface
     }
 
   private:
-    std::size_t MAX_QUEUE_SIZE = 256;
+    static constexpr std::size_t MAX_QUEUE_SIZE = 256;
     bool isProcessPolling = false;
     bool isPolling = false;
     bool isCritical = false;
@@ -88,6 +87,11 @@ class EventHandlerInterface
     void startCallback();
     void stopCallback();
 
+    /** @brief Serve the next queued event as soon as the current handling
+     *         returns, unless a poll is in progress or polling is stopped
+     */
+    void scheduleDispatch();
+
     struct ReqPollInfo
     {
         uint8_t operationFlag;
@@ -97,8 +101,7 @@ class EventHandlerInterface
     struct RecvPollInfo
     {
         uint8_t eventClass;
-        uint32_t totalSize;
-        std::vector<uint8_t> data;
+        EventDataReassembly data;
     };
 
   protected:
@@ -106,11 +109,22 @@ class EventHandlerInterface
     uint8_t instanceId;
     bool responseReceived = false;
     std::unique_ptr<sdbusplus::Timer> pollReqTimeoutTimer;
+    /** @brief Sequence number of the last poll request sent */
+    uint64_t pollSeq = 0;
     std::map<uint8_t, HandlerFunc> eventHndls;
-    std::deque<uint16_t> critEventQueue;
-    std::deque<uint16_t> overflowEventQueue;
+    RasEventScheduler rasEvents{MAX_QUEUE_SIZE};
     ReqPollInfo reqData;
     RecvPollInfo recvData;
+    /** @brief Sends the first part request of a dequeued event, or the
+     *         request following a response once it is handled
+     */
+    std::unique_ptr<sdeventplus::source::Defer> nextPartRequest;
+    /** @brief Serves the next queued event once the previous one is done,
+     *         the critical timer only picks up events when idle
+     */
+    std::unique_ptr<sdeventplus::source::Defer> dispatchRequest;
+    /** @brief Queue depths and latencies of the RAS events */
+    std::unique_ptr<pldm::dbus_api::DebugStats> rasEventStats;
 };
 
 } // namespace pldm
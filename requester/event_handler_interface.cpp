@@ -2,7 +2,10 @@
 #include "libpldm/pldm.h"
 #include "event_hander_interface.hpp"
 
+#include "cper.hpp"
+
 #include <assert.h>
+#include <endian.h>
 #include <systemd/sd-journal.h>
 
 #include <nlohmann/json.hpp>
@@ -17,6 +20,7 @@
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <span>
 #include <thread>
 
 using namespace pldm::utils;
@@ -38,6 +42,19 @@ EventHandlerInterface::EventHandlerInterface(
 {
     pollReqTimeoutTimer = std::make_unique<sdbusplus::Timer>(
                                  [&](void) { pollReqTimeoutHdl(); });
+    try
+    {
+        rasEventStats = std::make_unique<pldm::dbus_api::DebugStats>(
+            bus,
+            std::string(pldm::dbus_api::DebugStats::basePath) +
+                "/ras_events_" + std::to_string(eid),
+            [this]() { return rasEvents.getCounters(); });
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Failed to create the RAS event debug counters of eid "
+                  << unsigned(eid) << ", " << e.what() << std::endl;
+    }
     startCallback();
 }
 
@@ -60,26 +77,24 @@ void EventHandlerInterface::normalEventCb()
 
 void EventHandlerInterface::criticalEventCb()
 {
-    uint16_t eventId = 0;
+    dispatchRequest.reset();
 
-    if (isProcessPolling)
+    /* An event is being polled or about to be */
+    if (isProcessPolling || nextPartRequest)
         return;
-    if (critEventQueue.empty() && overflowEventQueue.empty())
+    auto next = rasEvents.front();
+    if (!next)
     {
         isCritical = false;
         return;
     }
-    if (!overflowEventQueue.empty())
+    uint16_t eventId = next->id;
+    /* An overflow event is polled until the terminus reports its queues
+     * empty, see clearOverflow().
+     */
+    if (next->priority != RasEventScheduler::Priority::Overflow)
     {
-        eventId = overflowEventQueue.front();
-    }
-    else
-    {
-        if (!critEventQueue.empty())
-        {
-            eventId = critEventQueue.front();
-            critEventQueue.pop_front();
-        }
+        rasEvents.pop(next->priority);
     }
     /* Has Critical Event */
     isCritical = true;
@@ -90,57 +105,53 @@ void EventHandlerInterface::criticalEventCb()
 #ifdef DEBUG
             std::cout << "\nHandle Critical EVENT_ID " << std::hex << eventId << "\n";
 #endif
-      pollEventReqTimer.restart(std::chrono::milliseconds(POLL_REQ_EVENT_TIMER));
+    /* Request the first part right away, the timers only pace the idle
+     * polling.
+     */
+    nextPartRequest = std::make_unique<sdeventplus::source::Defer>(
+        event, std::bind(&EventHandlerInterface::pollEventReqCb, this));
 }
 
 int EventHandlerInterface::enqueueCriticalEvent(uint16_t item)
 {
-    if (critEventQueue.size() > MAX_QUEUE_SIZE)
-        return -1;
-
-    for (auto& i : critEventQueue)
-    {
-        if (i == item)
-        {
-            return -2;
-        }
-    }
-
 #ifdef DEBUG
     std::cout << "\nQUEUING CRIT EVENT_ID " << std::hex << item << "\n";
 #endif
-    // insert to event queue
-    critEventQueue.push_back(item);
-
-    return 0;
+    auto rc = rasEvents.push(item, RasEventScheduler::Priority::Critical);
+    if (rc == 0)
+    {
+        scheduleDispatch();
+    }
+    return rc;
 }
 
 int EventHandlerInterface::enqueueOverflowEvent(uint16_t item)
 {
-    if (overflowEventQueue.size() > MAX_QUEUE_SIZE)
-        return -1;
-
-    for (auto& i : overflowEventQueue)
-    {
-        if (i == item)
-        {
-            return -2;
-        }
-    }
-
 #ifdef DEBUG
     std::cout << "\nQUEUING OVERFLOW EVENT_ID " << std::hex << item << "\n";
 #endif
-    // insert to event queue
-    overflowEventQueue.push_back(item);
-
-    return 0;
+    auto rc = rasEvents.push(item, RasEventScheduler::Priority::Overflow);
+    if (rc == 0)
+    {
+        scheduleDispatch();
+    }
+    return rc;
 }
 
 void EventHandlerInterface::clearOverflow()
 {
-    if (!overflowEventQueue.empty())
-        overflowEventQueue.pop_front();
+    rasEvents.pop(RasEventScheduler::Priority::Overflow);
+}
+
+void EventHandlerInterface::scheduleDispatch()
+{
+    /* Polling is stopped, the events wait for startEventSignalPolling() */
+    if (isProcessPolling || dispatchRequest || !critEventTimer.isEnabled())
+    {
+        return;
+    }
+    dispatchRequest = std::make_unique<sdeventplus::source::Defer>(
+        event, std::bind(&EventHandlerInterface::criticalEventCb, this));
 }
 
 void EventHandlerInterface::pollReqTimeoutHdl()
@@ -153,6 +164,7 @@ void EventHandlerInterface::pollReqTimeoutHdl()
 #endif
         // clear cached data
         resetCacheAndFlags();
+        scheduleDispatch();
     }
 }
 
@@ -169,9 +181,10 @@ void EventHandlerInterface::resetCacheAndFlags()
     responseReceived = false;
     memset(&reqData, 0, sizeof(struct ReqPollInfo));
     recvData.eventClass = 0;
-    recvData.totalSize = 0;
-    recvData.data.clear();
+    recvData.data.reset();
     pollEventReqTimer.setEnabled(false);
+    nextPartRequest.reset();
+    dispatchRequest.reset();
     isBertPolling = false;
 }
 
@@ -192,6 +205,12 @@ void EventHandlerInterface::processResponseMsg(mctp_eid_t /*eid*/,
     {
         error("No response received for processResponseMsg, EID = {EID}", "EID",
                       unsigned(eid));
+        /* The request failed or timed out, serve the next event rather than
+         * wait for the poll timeout.
+         */
+        pollReqTimeoutTimer->stop();
+        resetCacheAndFlags();
+        scheduleDispatch();
         return;
     }
     // announce that data is received
@@ -247,46 +266,64 @@ void EventHandlerInterface::processResponseMsg(mctp_eid_t /*eid*/,
             // In normal situation, dummy poll remaining CE RAS every 50ms
             normEventTimer.setRemaining(std::chrono::milliseconds(50));
         }
+        /* Serve the queued events back to back */
+        scheduleDispatch();
         return;
     }
 
     // found
     mProRASQueuesAreEmpty = false;
     int flag = static_cast<int>(retTransferFlag);
-    std::vector<uint8_t> retEventData(retEventDataSize, 0);
-    memcpy(retEventData.data(), eventData, retEventDataSize);
+    std::span<const uint8_t> part(eventData, retEventDataSize);
 
-    if (flag == PLDM_START)            /* Start part */
+    if ((flag == PLDM_START) || (flag == PLDM_START_AND_END))
     {
-        recvData.data.insert(recvData.data.begin(),
-                             retEventData.begin(),
-                             retEventData.begin() + retEventDataSize);
-        recvData.totalSize += retEventDataSize;
-        reqData.operationFlag = PLDM_GET_NEXTPART;
-        reqData.dataTransferHandle = retNextDataTransferHandle;
-        reqData.eventIdToAck = 0xffff;
+        /* The event data starts with its format and length, size the buffer
+         * for all the parts up front.
+         */
+        size_t expectedSize = 0;
+        if (part.size() >= sizeof(CommonEventData))
+        {
+            CommonEventData header;
+            memcpy(&header, part.data(), sizeof(header));
+            expectedSize = sizeof(CommonEventData) + le16toh(header.length);
+        }
+        recvData.data.reset(expectedSize);
+        recvData.eventClass = retEventClass;
     }
-    else if (flag == PLDM_MIDDLE)       /* Middle part */
+    else if ((flag != PLDM_MIDDLE) && (flag != PLDM_END))
+    {
+        /* Unknown transfer flag, the request is sent again */
+        return;
+    }
+
+    /* The first part is requested with the event ID as data transfer
+     * handle, the next ones with their offset in the event data.
+     */
+    uint32_t offset = ((flag == PLDM_START) || (flag == PLDM_START_AND_END))
+                          ? 0
+                          : reqData.dataTransferHandle;
+    if (!recvData.data.append(offset, part))
+    {
+        std::cerr << "Event data part at offset " << offset
+                  << " does not follow the " << recvData.data.size()
+                  << " bytes received, EVENT_ID=" << retEventId << "\n";
+        resetCacheAndFlags();
+        return;
+    }
+
+    if ((flag == PLDM_START) || (flag == PLDM_MIDDLE))
     {
-        recvData.data.insert(recvData.data.begin() + reqData.dataTransferHandle,
-                             retEventData.begin(),
-                             retEventData.begin() + retEventDataSize);
-        recvData.totalSize += retEventDataSize;
         reqData.operationFlag = PLDM_GET_NEXTPART;
         reqData.dataTransferHandle = retNextDataTransferHandle;
         reqData.eventIdToAck = 0xffff;
     }
-    else if ((flag == PLDM_END) || (flag == PLDM_START_AND_END))  /* End part */
+    else /* End part */
     {
-        recvData.data.insert(recvData.data.begin() + reqData.dataTransferHandle,
-                             retEventData.begin(),
-                             retEventData.begin() + retEventDataSize);
-        recvData.totalSize += retEventDataSize;
-
         /* eventDataIntegrityChecksum field is only used for multi-part transfer.
          * If single-part, ignore checksum.
          */
-        uint32_t checksum = crc32(recvData.data.data(), recvData.data.size());
+        uint32_t checksum = recvData.data.checksum();
         if ((flag == PLDM_END) && (checksum != retEventDataIntegrityChecksum))
         {
             std::cerr << "\nchecksum isn't correct chks=" << std::hex << checksum
@@ -299,8 +336,8 @@ void EventHandlerInterface::processResponseMsg(mctp_eid_t /*eid*/,
             auto it = eventHndls.find(retEventClass);
             if (it != eventHndls.end())
             {
-                eventHndls.at(retEventClass)(retTid, retEventClass,
-                            retEventId, recvData.data);
+                it->second(retTid, retEventClass, retEventId,
+                           recvData.data.data());
             }
         }
 
@@ -308,10 +345,17 @@ void EventHandlerInterface::processResponseMsg(mctp_eid_t /*eid*/,
         reqData.dataTransferHandle = 0;
         reqData.eventIdToAck = retEventId;
     }
+
+    /* Request the next part, or acknowledge the event, as soon as this
+     * response is handled rather than on the next poll timer tick.
+     */
+    nextPartRequest = std::make_unique<sdeventplus::source::Defer>(
+        event, std::bind(&EventHandlerInterface::pollEventReqCb, this));
 #ifdef DEBUG
         std::cout << "\nEVENT_ID:" << retEventId
-                  << " DATA LENGTH:" << recvData.totalSize << "\n ";
-        for (auto it = recvData.data.begin(); it != recvData.data.end(); it++)
+                  << " DATA LENGTH:" << recvData.data.size() << "\n ";
+        for (auto it = recvData.data.data().begin();
+             it != recvData.data.data().end(); it++)
         {
             std::cout << std::setfill('0') << std::setw(2) << std::hex
                       << (unsigned)*it << " ";
@@ -323,6 +367,8 @@ void EventHandlerInterface::processResponseMsg(mctp_eid_t /*eid*/,
 
 void EventHandlerInterface::pollEventReqCb()
 {
+    nextPartRequest.reset();
+
     std::vector<uint8_t> requestMsg(sizeof(pldm_msg_hdr) +
                          PLDM_POLL_FOR_PLATFORM_EVENT_MESSAGE_REQ_BYTES);
     auto request = reinterpret_cast<pldm_msg*>(requestMsg.data());
@@ -352,11 +398,18 @@ void EventHandlerInterface::pollEventReqCb()
         return;
     }
 
+    /* A response to a poll given up on must not end the current one */
+    auto seq = ++pollSeq;
     rc = handler->registerRequest(
         eid, instanceId, PLDM_PLATFORM, PLDM_POLL_FOR_PLATFORM_EVENT_MESSAGE,
         std::move(requestMsg),
-        std::move(
-            std::bind_front(&EventHandlerInterface::processResponseMsg, this)));
+        [this, seq](mctp_eid_t eid, const pldm_msg* response,
+                    size_t respMsgLen) {
+        if (seq == pollSeq)
+        {
+            processResponseMsg(eid, response, respMsgLen);
+        }
+    });
     if (rc)
     {
         std::cerr << "ERROR: failed to send the poll request\n";
@@ -434,9 +487,8 @@ void EventHandlerInterface::addEventMsg(uint8_t eventId, uint8_t eventType,
          * Also clear the queue to make sure BERT event is handled asap .
          */
         stopEventSignalPolling();
-        critEventQueue.clear();
-        overflowEventQueue.clear();
-        critEventQueue.push_back(eventId);
+        rasEvents.clear();
+        rasEvents.push(eventId, RasEventScheduler::Priority::Bert);
         isBertPolling = true;
         /* handle event id 200 as soon as possible */
         criticalEventCb();
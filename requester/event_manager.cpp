@@ -51,6 +51,21 @@ int EventManager::handleMessagePollEvent(const pldm_msg* request,
     return PLDM_SUCCESS;
 }
 
+int EventManager::handlePDRRepositoryChgEvent(const pldm_msg* /* request */,
+                                              size_t /* payloadLength */,
+                                              uint8_t /* formatVersion */,
+                                              uint8_t tid,
+                                              size_t /* eventDataOffset */)
+{
+    /* Any change makes the cached PDRs stale, the changed records are picked
+     * up on the next discovery of the terminus */
+    if (devManager && devManager->invalidatePDRCache(tid))
+    {
+        return PLDM_SUCCESS;
+    }
+    return PLDM_ERROR_INVALID_DATA;
+}
+
 int EventManager::handleSensorEvent(const pldm_msg* request,
                                           size_t payloadLength,
                                           uint8_t /* formatVersion */,
@@ -119,6 +134,12 @@ int EventManager::processNumericSensorEvent(uint8_t tid, uint16_t sensorId,
         }
     }
 
+    if (devManager)
+    {
+        devManager->updateSensorFromEvent(tid, sensorId, sensorDataSize,
+                                          presentReading);
+    }
+
     return PLDM_SUCCESS;
 }
 
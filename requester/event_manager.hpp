@@ -31,6 +31,10 @@ class EventManager
                            size_t payloadLength,
                            uint8_t /* formatVersion */, uint8_t tid,
                            size_t eventDataOffset);
+    int handlePDRRepositoryChgEvent(const pldm_msg* request,
+                                    size_t payloadLength,
+                                    uint8_t /* formatVersion */, uint8_t tid,
+                                    size_t eventDataOffset);
 
   protected:
 
@@ -0,0 +1,162 @@
+#include "fault_log_writer.hpp"
+
+#include <fcntl.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <iostream>
+#include <system_error>
+
+namespace pldm
+{
+
+FaultLogWriter::FaultLogWriter(sdeventplus::Event& event, size_t maxQueued) :
+    maxQueued(maxQueued)
+{
+    notifyFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (notifyFd < 0)
+    {
+        throw std::system_error(errno, std::generic_category(),
+                                "Failed to create the fault log eventfd");
+    }
+    notifySource = std::make_unique<sdeventplus::source::IO>(
+        event, notifyFd, EPOLLIN,
+        [this](sdeventplus::source::IO&, int fd, uint32_t) {
+        uint64_t count = 0;
+        if (read(fd, &count, sizeof(count)) < 0 && errno != EAGAIN)
+        {
+            std::cerr << "Failed to read the fault log eventfd, ERRNO="
+                      << errno << "\n";
+        }
+        deliverCompletions();
+    });
+    worker = std::thread(&FaultLogWriter::run, this);
+}
+
+FaultLogWriter::~FaultLogWriter()
+{
+    {
+        std::lock_guard guard(lock);
+        stopping = true;
+    }
+    wakeup.notify_one();
+    worker.join();
+    notifySource.reset();
+    close(notifyFd);
+}
+
+bool FaultLogWriter::submit(Job&& job)
+{
+    {
+        std::lock_guard guard(lock);
+        if (queued.size() >= maxQueued)
+        {
+            dropped++;
+            return false;
+        }
+        queued.emplace_back(std::move(job));
+        submitted++;
+        maxDepth = std::max<uint64_t>(maxDepth, queued.size());
+    }
+    wakeup.notify_one();
+    return true;
+}
+
+FaultLogWriter::Counters FaultLogWriter::getCounters() const
+{
+    std::lock_guard guard(lock);
+    return {{"Submitted", submitted},
+            {"Written", written},
+            {"Failed", failed},
+            {"Dropped", dropped},
+            {"Queued", queued.size()},
+            {"MaxQueued", maxDepth}};
+}
+
+void FaultLogWriter::run()
+{
+    std::unique_lock guard(lock);
+    while (true)
+    {
+        wakeup.wait(guard, [this]() { return stopping || !queued.empty(); });
+        if (stopping)
+        {
+            return;
+        }
+
+        auto job = std::move(queued.front());
+        queued.pop_front();
+        guard.unlock();
+
+        bool ok = writeFile(job.path, job.produce());
+
+        guard.lock();
+        if (ok)
+        {
+            written++;
+        }
+        else
+        {
+            failed++;
+        }
+        if (job.done)
+        {
+            completed.emplace_back(std::move(job.done), ok);
+            uint64_t one = 1;
+            if (write(notifyFd, &one, sizeof(one)) < 0)
+            {
+                std::cerr << "Failed to post a fault log completion, ERRNO="
+                          << errno << "\n";
+            }
+        }
+    }
+}
+
+bool FaultLogWriter::writeFile(const std::filesystem::path& path,
+                               const std::vector<uint8_t>& content)
+{
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                  0644);
+    if (fd < 0)
+    {
+        std::cerr << "Failed to create fault log " << path
+                  << ", ERRNO=" << errno << "\n";
+        return false;
+    }
+
+    size_t offset = 0;
+    while (offset < content.size())
+    {
+        auto rc = write(fd, content.data() + offset, content.size() - offset);
+        if (rc < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            std::cerr << "Failed to write fault log " << path
+                      << ", ERRNO=" << errno << "\n";
+            close(fd);
+            return false;
+        }
+        offset += rc;
+    }
+    return close(fd) == 0;
+}
+
+void FaultLogWriter::deliverCompletions()
+{
+    std::deque<std::pair<std::function<void(bool)>, bool>> ready;
+    {
+        std::lock_guard guard(lock);
+        ready.swap(completed);
+    }
+    for (auto& [done, ok] : ready)
+    {
+        done(ok);
+    }
+}
+
+} // namespace pldm
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <sdeventplus/event.hpp>
+#include <sdeventplus/source/io.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace pldm
+{
+
+/** @class FaultLogWriter
+ *
+ *  Writes fault log files, such as decoded CPER records, on a worker thread so
+ *  that an error storm does not stall the event loop with file I/O. Each job
+ *  produces the content of its file on the worker, which writes it to the
+ *  final path in one write. The completion of the job is then posted back to
+ *  the event loop, where the logs referencing the file can be created.
+ *
+ *  The queue of jobs is bounded, a job submitted while the queue is full is
+ *  dropped and counted.
+ */
+class FaultLogWriter
+{
+  public:
+    /** @brief A fault log file to write */
+    struct Job
+    {
+        /** @brief Final path of the file */
+        std::filesystem::path path;
+        /** @brief Produces the content of the file, called on the worker */
+        std::function<std::vector<uint8_t>()> produce;
+        /** @brief Called on the event loop once the file is written, with
+         *         whether it was written
+         */
+        std::function<void(bool)> done;
+    };
+
+    using Counters = std::map<std::string, uint64_t>;
+
+    FaultLogWriter() = delete;
+    FaultLogWriter(const FaultLogWriter&) = delete;
+    FaultLogWriter(FaultLogWriter&&) = delete;
+    FaultLogWriter& operator=(const FaultLogWriter&) = delete;
+    FaultLogWriter& operator=(FaultLogWriter&&) = delete;
+
+    /** @brief Constructor, starts the worker
+     *
+     *  @param[in] event - event loop the completions are posted to
+     *  @param[in] maxQueued - number of jobs which can wait for the worker
+     */
+    FaultLogWriter(sdeventplus::Event& event, size_t maxQueued);
+
+    /** @brief Destructor, the worker finishes the file being written, the
+     *         jobs still queued and the completions not delivered are dropped
+     */
+    ~FaultLogWriter();
+
+    /** @brief Queue a fault log file to write
+     *
+     *  @param[in] job - the file to write
+     *
+     *  @return false if the queue is full and the job is dropped
+     */
+    bool submit(Job&& job);
+
+    /** @brief Get the counters of the writer */
+    Counters getCounters() const;
+
+  private:
+    /** @brief Worker thread body */
+    void run();
+
+    /** @brief Write a file in one write
+     *
+     *  @return true if the whole content is written
+     */
+    static bool writeFile(const std::filesystem::path& path,
+                          const std::vector<uint8_t>& content);
+
+    /** @brief Deliver the completions posted by the worker, on the loop */
+    void deliverCompletions();
+
+    const size_t maxQueued;
+
+    /** @brief Wakes up the event loop when completions are posted */
+    int notifyFd = -1;
+    std::unique_ptr<sdeventplus::source::IO> notifySource;
+
+    mutable std::mutex lock;
+    std::condition_variable wakeup;
+    bool stopping = false;
+    /** @brief Jobs waiting for the worker */
+    std::deque<Job> queued;
+    /** @brief Completions waiting for the event loop */
+    std::deque<std::pair<std::function<void(bool)>, bool>> completed;
+
+    uint64_t submitted = 0;
+    uint64_t written = 0;
+    uint64_t failed = 0;
+    uint64_t dropped = 0;
+    uint64_t maxDepth = 0;
+
+    std::thread worker;
+};
+
+} // namespace pldm
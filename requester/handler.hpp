@@ -13,6 +13,7 @@
 #include <sdeventplus/event.hpp>
 #include <sdeventplus/source/event.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <coroutine>
@@ -23,6 +24,8 @@
 #include <queue>
 #include <tuple>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 PHOSPHOR_LOG2_USING;
 
@@ -78,16 +81,21 @@ struct RegisteredRequest
     ResponseHandler responseHandler; //!< Waiting for response flag
 };
 
+/** @brief Upper bound of the in-flight window to one endpoint, the PLDM
+ *         instance ID is 5 bits wide so at most 32 requests can be outstanding
+ */
+constexpr uint8_t maxInflightWindow = PLDM_INSTANCE_MAX + 1;
+
 /** @struct EndpointMessageQueue
  *
  *  This struct is used to save the list of request messages of one endpoint and
- *  the existing of the request message to the endpoint with its' EID.
+ *  the number of request messages in flight to the endpoint with its' EID.
  */
 struct EndpointMessageQueue
 {
     mctp_eid_t eid; //!< Responder MCTP endpoint ID
     std::deque<std::shared_ptr<RegisteredRequest>> requestQueue; //!< Queue
-    bool activeRequest; //!< Waiting for response flag
+    uint8_t activeRequests; //!< Number of requests waiting for response
 
     bool operator==(const mctp_eid_t& mctpEid) const
     {
@@ -126,6 +134,8 @@ class Handler
      *  @param[in] instanceIdExpiryInterval - instance ID expiration interval
      *  @param[in] numRetries - number of request retries
      *  @param[in] responseTimeOut - time to wait between each retry
+     *  @param[in] inflightWindow - maximum number of outstanding requests to
+     *                              one endpoint, clamped to [1, 32]
      */
     explicit Handler(
         PldmTransport* pldmTransport, sdeventplus::Event& event,
@@ -134,13 +144,43 @@ class Handler
             std::chrono::seconds(INSTANCE_ID_EXPIRATION_INTERVAL),
         uint8_t numRetries = static_cast<uint8_t>(NUMBER_OF_REQUEST_RETRIES),
         std::chrono::milliseconds responseTimeOut =
-            std::chrono::milliseconds(RESPONSE_TIME_OUT)) :
+            std::chrono::milliseconds(RESPONSE_TIME_OUT),
+        uint8_t inflightWindow =
+            static_cast<uint8_t>(MAX_INFLIGHT_REQUESTS_PER_ENDPOINT)) :
         pldmTransport(pldmTransport),
         event(event), instanceIdDb(instanceIdDb), verbose(verbose),
         instanceIdExpiryInterval(instanceIdExpiryInterval),
-        numRetries(numRetries), responseTimeOut(responseTimeOut)
+        numRetries(numRetries), responseTimeOut(responseTimeOut),
+        inflightWindow(std::clamp<uint8_t>(inflightWindow, 1,
+                                           maxInflightWindow))
     {}
 
+    /** @brief Get the maximum number of outstanding requests per endpoint
+     *
+     *  @return the in-flight window size
+     */
+    uint8_t getInflightWindow() const
+    {
+        return inflightWindow;
+    }
+
+    /** @brief Get the number of requests waiting for a response from an
+     *         endpoint
+     *
+     *  @param[in] eid - endpoint ID of the remote MCTP endpoint
+     *
+     *  @return the number of requests in flight to the endpoint
+     */
+    uint8_t getActiveRequests(mctp_eid_t eid) const
+    {
+        auto it = endpointMessageQueues.find(eid);
+        if (it == endpointMessageQueues.end())
+        {
+            return 0;
+        }
+        return it->second->activeRequests;
+    }
+
     void instanceIdExpiryCallBack(RequestKey key)
     {
         auto eid = key.eid;
@@ -168,7 +208,7 @@ class Handler
                 key,
                 std::make_unique<sdeventplus::source::Defer>(
                     event, std::bind(&Handler::removeRequestEntry, this, key)));
-            endpointMessageQueues[eid]->activeRequest = false;
+            releaseSlot(eid);
 
             /* try to send new request if the endpoint is free */
             pollEndpointQueue(eid);
@@ -182,21 +222,44 @@ class Handler
         }
     }
 
-    /** @brief Send the remaining PLDM request messages in endpoint queue
+    /** @brief Send the remaining PLDM request messages in endpoint queue until
+     *         the in-flight window of the endpoint is full
      *
      *  @param[in] eid - endpoint ID of the remote MCTP endpoint
+     *
+     *  @return PLDM_SUCCESS if every request was sent, PLDM_ERROR otherwise
      */
     int pollEndpointQueue(mctp_eid_t eid)
     {
-        if (endpointMessageQueues[eid]->activeRequest ||
-            endpointMessageQueues[eid]->requestQueue.empty())
+        auto& endpointQueue = endpointMessageQueues[eid];
+        int rc = PLDM_SUCCESS;
+        while (endpointQueue->activeRequests < inflightWindow &&
+               !endpointQueue->requestQueue.empty())
         {
-            return PLDM_SUCCESS;
+            // A request failing to send doesn't hold back the next ones
+            if (sendQueuedRequest(endpointQueue))
+            {
+                rc = PLDM_ERROR;
+            }
         }
 
-        endpointMessageQueues[eid]->activeRequest = true;
-        auto requestMsg = endpointMessageQueues[eid]->requestQueue.front();
-        endpointMessageQueues[eid]->requestQueue.pop_front();
+        return rc;
+    }
+
+    /** @brief Send the request message at the front of an endpoint queue
+     *
+     *  @details The response handler of a request failing to send is called
+     *  with an empty response from the event loop, as on a timeout.
+     *
+     *  @param[in] endpointQueue - the queue of the remote MCTP endpoint
+     *
+     *  @return return PLDM_SUCCESS on success and PLDM_ERROR otherwise
+     */
+    int sendQueuedRequest(std::shared_ptr<EndpointMessageQueue>& endpointQueue)
+    {
+        endpointQueue->activeRequests++;
+        auto requestMsg = endpointQueue->requestQueue.front();
+        endpointQueue->requestQueue.pop_front();
 
         auto request = std::make_unique<RequestInterface>(
             pldmTransport, requestMsg->key.eid, event,
@@ -211,7 +274,9 @@ class Handler
         {
             instanceIdDb.free(requestMsg->key.eid, requestMsg->key.instanceId);
             error("Failure to send the PLDM request message");
-            endpointMessageQueues[eid]->activeRequest = false;
+            endpointQueue->activeRequests--;
+            deferFailedResponse(requestMsg->key.eid,
+                                std::move(requestMsg->responseHandler));
             return rc;
         }
 
@@ -226,7 +291,9 @@ class Handler
             error(
                 "Failed to start the instance ID expiry timer. RC = {ERR_EXCEP}",
                 "ERR_EXCEP", e.what());
-            endpointMessageQueues[eid]->activeRequest = false;
+            endpointQueue->activeRequests--;
+            deferFailedResponse(requestMsg->key.eid,
+                                std::move(requestMsg->responseHandler));
             return PLDM_ERROR;
         }
 
@@ -272,7 +339,7 @@ class Handler
             std::deque<std::shared_ptr<RegisteredRequest>> reqQueue;
             reqQueue.push_back(inputRequest);
             endpointMessageQueues[eid] =
-                std::make_shared<EndpointMessageQueue>(eid, reqQueue, false);
+                std::make_shared<EndpointMessageQueue>(eid, reqQueue, 0);
         }
 
         /* try to send new request if the endpoint is free */
@@ -309,7 +376,7 @@ class Handler
             instanceIdDb.free(key.eid, key.instanceId);
             handlers.erase(key);
 
-            endpointMessageQueues[eid]->activeRequest = false;
+            releaseSlot(eid);
             /* try to send new request if the endpoint is free */
             pollEndpointQueue(eid);
         }
@@ -333,6 +400,7 @@ class Handler
     uint8_t numRetries;               //!< number of request retries
     std::chrono::milliseconds
         responseTimeOut;              //!< time to wait between each retry
+    uint8_t inflightWindow; //!< max outstanding requests per endpoint
 
     /** @brief Container for storing the details of the PLDM request
      *         message, handler for the corresponding PLDM response and the
@@ -356,6 +424,58 @@ class Handler
                        RequestKeyHasher>
         removeRequestContainer;
 
+    /** @brief Response handlers of the requests which failed to send, with
+     *         the endpoint ID of each request
+     */
+    std::vector<std::pair<mctp_eid_t, ResponseHandler>> failedResponses;
+
+    /** @brief Calls the response handlers of the failed requests */
+    std::unique_ptr<sdeventplus::source::Defer> failedResponsesDefer;
+
+    /** @brief Call the response handler of a request which failed to send
+     *         from the event loop, the requester may not expect it to be
+     *         called before registerRequest returns
+     *
+     *  @param[in] eid - endpoint ID of the remote MCTP endpoint
+     *  @param[in] responseHandler - response handler of the request
+     */
+    void deferFailedResponse(mctp_eid_t eid, ResponseHandler&& responseHandler)
+    {
+        failedResponses.emplace_back(eid, std::move(responseHandler));
+        if (!failedResponsesDefer)
+        {
+            failedResponsesDefer =
+                std::make_unique<sdeventplus::source::Defer>(
+                    event, std::bind(&Handler::callFailedResponses, this));
+        }
+    }
+
+    /** @brief Call the response handlers of the requests which failed to send
+     *         with an empty response to indicate no response
+     */
+    void callFailedResponses()
+    {
+        auto failed = std::exchange(failedResponses, {});
+        failedResponsesDefer.reset();
+        for (auto& [eid, responseHandler] : failed)
+        {
+            responseHandler(eid, nullptr, 0);
+        }
+    }
+
+    /** @brief Release one in-flight slot of an endpoint
+     *
+     *  @param[in] eid - endpoint ID of the remote MCTP endpoint
+     */
+    void releaseSlot(mctp_eid_t eid)
+    {
+        auto& endpointQueue = endpointMessageQueues[eid];
+        if (endpointQueue->activeRequests)
+        {
+            endpointQueue->activeRequests--;
+        }
+    }
+
     /** @brief Remove request entry for which the instance ID expired
      *
      *  @param[in] key - key for the Request
@@ -54,6 +54,7 @@ MctpDiscovery::MctpDiscovery(sdbusplus::bus_t& bus,
     }
 
     std::vector<mctp_eid_t> eids;
+    std::map<mctp_eid_t, std::string> uuids;
 
     for (const auto& [objectPath, interfaces] : objects)
     {
@@ -71,6 +72,7 @@ MctpDiscovery::MctpDiscovery(sdbusplus::bus_t& bus,
                         types.end())
                     {
                         eids.emplace_back(eid);
+                        uuids.emplace(eid, getUUID(interfaces));
                     }
                 }
             }
@@ -87,7 +89,7 @@ MctpDiscovery::MctpDiscovery(sdbusplus::bus_t& bus,
 
     if (eids.size() && devManager)
     {
-        devManager->addDevices(eids);
+        devManager->addDevices(eids, uuids);
     }
 }
 
@@ -96,6 +98,7 @@ void MctpDiscovery::dicoverEndpoints(sdbusplus::message_t& msg)
     constexpr std::string_view mctpEndpointIntfName{
         "xyz.openbmc_project.MCTP.Endpoint"};
     std::vector<mctp_eid_t> eids;
+    std::map<mctp_eid_t, std::string> uuids;
 
     sdbusplus::message::object_path objPath;
     std::map<std::string, std::map<std::string, dbus::Value>> interfaces;
@@ -118,6 +121,7 @@ void MctpDiscovery::dicoverEndpoints(sdbusplus::message_t& msg)
                         types.end())
                     {
                         eids.emplace_back(eid);
+                        uuids.emplace(eid, getUUID(interfaces));
                         /* Add eid to list Endpoints */
                         if (!std::count(listEids.begin(), listEids.end(), eid))
                         {
@@ -136,7 +140,7 @@ void MctpDiscovery::dicoverEndpoints(sdbusplus::message_t& msg)
 
     if (eids.size() && devManager)
     {
-        devManager->addDevices(eids);
+        devManager->addDevices(eids, uuids);
     }
 }
 
@@ -230,4 +234,15 @@ void MctpDiscovery::removeEndpoints(sdbusplus::message_t& msg)
     return;
 }
 
+std::string MctpDiscovery::getUUID(const dbus::InterfaceMap& interfaces)
+{
+    auto intf = interfaces.find(std::string(uuidIntfName));
+    if (intf == interfaces.end() || !intf->second.contains("UUID"))
+    {
+        return {};
+    }
+    auto uuid = std::get_if<std::string>(&intf->second.at("UUID"));
+    return uuid ? *uuid : std::string{};
+}
+
 } // namespace pldm
@@ -46,11 +46,22 @@ class MctpDiscovery
 
     void removeEndpoints(sdbusplus::message_t& msg);
 
+    /** @brief Get the UUID of an MCTP endpoint object
+     *
+     *  @param[in] interfaces - interfaces of the endpoint object
+     *
+     *  @return the UUID, empty if the endpoint doesn't report one
+     */
+    static std::string getUUID(const dbus::InterfaceMap& interfaces);
+
     static constexpr uint8_t mctpTypePLDM = 1;
 
     static constexpr std::string_view mctpEndpointIntfName{
         "xyz.openbmc_project.MCTP.Endpoint"};
 
+    static constexpr std::string_view uuidIntfName{
+        "xyz.openbmc_project.Common.UUID"};
+
     /* List MCTP endpoint in MCTP D-Bus interface or Static EID table */
     std::vector<mctp_eid_t> listEids;
 };
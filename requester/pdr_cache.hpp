@@ -0,0 +1,218 @@
+#pragma once
+
+#include <libpldm/platform.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace pldm
+{
+
+namespace terminus
+{
+
+/** @struct PDRRepositoryInfo
+ *  @brief Signature of the PDR repository of a terminus
+ *  @details The fields of the GetPDRRepositoryInfo response which change
+ *  whenever the content of the repository changes.
+ */
+struct PDRRepositoryInfo
+{
+    std::array<uint8_t, PLDM_TIMESTAMP104_SIZE> updateTime{};
+    std::array<uint8_t, PLDM_TIMESTAMP104_SIZE> oemUpdateTime{};
+    uint32_t recordCount = 0;
+    uint32_t repositorySize = 0;
+    uint32_t largestRecordSize = 0;
+
+    bool operator==(const PDRRepositoryInfo&) const = default;
+
+    /** @brief Whether the terminus reports when its repository was updated,
+     *  the signature can't tell a changed repository apart otherwise
+     */
+    bool hasUpdateTime() const
+    {
+        auto isSet = [](const auto& time) {
+            return std::any_of(time.begin(), time.end(),
+                               [](uint8_t byte) { return byte != 0; });
+        };
+        return isSet(updateTime) || isSet(oemUpdateTime);
+    }
+};
+
+/** @class PDRCache
+ *
+ *  Keeps the PDRs fetched from a terminus in a file so that they can be
+ *  replayed on the next discovery instead of being fetched again. The file
+ *  holds the repository signature and the number of PDRs, followed by the
+ *  record handle, length and bytes of each PDR. The cached PDRs are only
+ *  returned when the signature matches the one the terminus reports.
+ */
+class PDRCache
+{
+  public:
+    using Records = std::vector<std::pair<uint32_t, std::vector<uint8_t>>>;
+
+    /** @brief Constructor
+     *
+     *  @param[in] path - file holding the PDRs of the terminus
+     */
+    explicit PDRCache(std::filesystem::path path) : path(std::move(path)) {}
+
+    /** @brief Load the cached PDRs
+     *
+     *  @param[in] info - repository signature reported by the terminus
+     *
+     *  @return the cached PDRs, std::nullopt when there is no cache, it is
+     *          corrupted or it was taken from a different repository
+     */
+    std::optional<Records> load(const PDRRepositoryInfo& info) const
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+        {
+            return std::nullopt;
+        }
+
+        uint32_t fileMagic = 0;
+        uint8_t fileVersion = 0;
+        PDRRepositoryInfo fileInfo{};
+        read(file, fileMagic);
+        read(file, fileVersion);
+        file.read(reinterpret_cast<char*>(fileInfo.updateTime.data()),
+                  fileInfo.updateTime.size());
+        file.read(reinterpret_cast<char*>(fileInfo.oemUpdateTime.data()),
+                  fileInfo.oemUpdateTime.size());
+        read(file, fileInfo.recordCount);
+        read(file, fileInfo.repositorySize);
+        read(file, fileInfo.largestRecordSize);
+        if (!file || fileMagic != magic || fileVersion != version ||
+            fileInfo != info)
+        {
+            return std::nullopt;
+        }
+
+        uint32_t count = 0;
+        read(file, count);
+        if (!file)
+        {
+            return std::nullopt;
+        }
+
+        Records records;
+        records.reserve(count);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            uint32_t recordHandle = 0;
+            uint32_t length = 0;
+            read(file, recordHandle);
+            read(file, length);
+            if (!file || length < sizeof(pldm_pdr_hdr) ||
+                length > UINT16_MAX)
+            {
+                return std::nullopt;
+            }
+            std::vector<uint8_t> pdr(length);
+            file.read(reinterpret_cast<char*>(pdr.data()), length);
+            if (!file)
+            {
+                return std::nullopt;
+            }
+            records.emplace_back(recordHandle, std::move(pdr));
+        }
+
+        return records;
+    }
+
+    /** @brief Replace the cached PDRs
+     *
+     *  @param[in] info - repository signature the PDRs were fetched with
+     *  @param[in] records - record handle and bytes of each PDR
+     *
+     *  @return true if the PDRs are stored
+     */
+    bool store(const PDRRepositoryInfo& info, const Records& records) const
+    {
+        std::error_code ec;
+        std::filesystem::create_directories(path.parent_path(), ec);
+
+        /* Write aside and rename so a reader never sees a partial cache */
+        auto tmpPath = path;
+        tmpPath += ".tmp";
+        {
+            std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+            if (!file)
+            {
+                return false;
+            }
+            write(file, magic);
+            write(file, version);
+            file.write(reinterpret_cast<const char*>(info.updateTime.data()),
+                       info.updateTime.size());
+            file.write(
+                reinterpret_cast<const char*>(info.oemUpdateTime.data()),
+                info.oemUpdateTime.size());
+            write(file, info.recordCount);
+            write(file, info.repositorySize);
+            write(file, info.largestRecordSize);
+            write(file, static_cast<uint32_t>(records.size()));
+            for (const auto& [recordHandle, pdr] : records)
+            {
+                write(file, recordHandle);
+                write(file, static_cast<uint32_t>(pdr.size()));
+                file.write(reinterpret_cast<const char*>(pdr.data()),
+                           pdr.size());
+            }
+            if (!file.flush())
+            {
+                std::filesystem::remove(tmpPath, ec);
+                return false;
+            }
+        }
+
+        std::filesystem::rename(tmpPath, path, ec);
+        if (ec)
+        {
+            std::filesystem::remove(tmpPath, ec);
+            return false;
+        }
+        return true;
+    }
+
+    /** @brief Drop the cached PDRs */
+    void invalidate() const
+    {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+    }
+
+  private:
+    template <typename T>
+    static void read(std::ifstream& file, T& value)
+    {
+        file.read(reinterpret_cast<char*>(&value), sizeof(value));
+    }
+
+    template <typename T>
+    static void write(std::ofstream& file, const T& value)
+    {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    /** @brief "PDRC" */
+    static constexpr uint32_t magic = 0x43524450;
+    static constexpr uint8_t version = 1;
+
+    /** @brief File holding the PDRs of the terminus */
+    std::filesystem::path path;
+};
+
+} // namespace terminus
+
+} // namespace pldm
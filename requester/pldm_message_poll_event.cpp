@@ -25,6 +25,7 @@
 #include <thread>
 #include <filesystem>
 #include <cstring>
+#include <span>
 #include "cper.hpp"
 
 #undef DEBUG
@@ -41,11 +42,26 @@ PldmMessagePollEvent::PldmMessagePollEvent(
     uint8_t eid, sdeventplus::Event& event, sdbusplus::bus::bus& bus,
     InstanceIdDb& instanceIdDb,
     pldm::requester::Handler<pldm::requester::Request>* handler) :
-    EventHandlerInterface(eid, event, bus, instanceIdDb, handler)
+    EventHandlerInterface(eid, event, bus, instanceIdDb, handler),
+    cperWriter(std::make_unique<FaultLogWriter>(event, CPER_WRITE_QUEUE_DEPTH))
 {
     if (!std::filesystem::is_directory(CPER_LOG_PATH))
          std::filesystem::create_directories(CPER_LOG_PATH);
 
+    try
+    {
+        cperWriterStats = std::make_unique<pldm::dbus_api::DebugStats>(
+            bus,
+            std::string(pldm::dbus_api::DebugStats::basePath) +
+                "/cper_writer_" + std::to_string(eid),
+            [this]() { return cperWriter->getCounters(); });
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Failed to create the CPER writer debug counters of eid "
+                  << unsigned(eid) << ", " << e.what() << std::endl;
+    }
+
     // register event class handler
     registerEventHandler(PLDM_MESSAGE_POLL_EVENT,
                          [&](uint8_t TID, uint8_t eventClass, uint16_t eventID,
@@ -74,34 +90,54 @@ int PldmMessagePollEvent::pldmPollForEventMessage(uint8_t TID,
     }
     std::cout << "\n";
 #endif
-    long pos;
-    AmpereSpecData ampHdr;
-    CommonEventData evtData;
-    pos = 0;
-
-    std::memcpy((void*)&evtData, (void*)&data[pos], sizeof(CommonEventData));
-    pos += sizeof(CommonEventData);
-
-    if (!std::filesystem::is_directory(CPER_LOG_DIR))
-         std::filesystem::create_directories(CPER_LOG_DIR);
-
-    std::string cperFile = std::string(CPER_LOG_DIR) + "cper.dump." + std::to_string(TID);
-    std::ofstream out (cperFile.c_str(), std::ofstream::binary);
-    if(!out.is_open())
+    if (data.size() < sizeof(CommonEventData))
     {
-        std::cerr << "Can not open ofstream for CPER binary file\n";
+        std::cerr << "CPER event data too short, size " << data.size()
+                  << "\n";
         return -1;
     }
-    decodeCperRecord(data, pos, &ampHdr, out);
-    out.close();
+    int size = data.size();
 
     std::string prefix = "RAS_CPER_";
     std::string primaryLogId = pldm::utils::getUniqueEntryID(prefix);
-    std::string type = "CPER";
-    std::string faultLogFilePath = std::string(CPER_LOG_PATH) + primaryLogId;
-    std::filesystem::copy(cperFile.c_str(), faultLogFilePath.c_str());
-    std::filesystem::remove(cperFile.c_str());
+    auto ampHdr = std::make_shared<AmpereSpecData>();
+
+    /* Decode and write the record off the event loop, the logs referencing
+     * it are created once it is on disk.
+     */
+    FaultLogWriter::Job job{
+        std::filesystem::path(CPER_LOG_PATH) / primaryLogId,
+        [data = std::move(data), ampHdr]() {
+        auto record = std::span(data).subspan(sizeof(CommonEventData));
+        std::vector<uint8_t> out;
+        if (decodeCperRecord(record, ampHdr.get(), out) < 0)
+        {
+            /* Keep the malformed record as received */
+            out.assign(record.begin(), record.end());
+        }
+        return out;
+    },
+        [this, TID, eventID, primaryLogId, ampHdr](bool written) {
+        if (written)
+        {
+            logCperRecord(TID, eventID, primaryLogId, *ampHdr);
+        }
+    }};
+    if (!cperWriter->submit(std::move(job)))
+    {
+        std::cerr << "CPER writer queue full, dropped EVENT_ID=" << eventID
+                  << " of TID " << unsigned(TID) << "\n";
+        return -1;
+    }
 
+    return size;
+}
+
+void PldmMessagePollEvent::logCperRecord(uint8_t TID, uint16_t eventID,
+                                         std::string primaryLogId,
+                                         AmpereSpecData ampHdr)
+{
+    std::string type = "CPER";
     addCperSELLog(TID, eventID, &ampHdr);
     pldm::utils::addFaultLogToRedfish(primaryLogId, type);
 
@@ -127,9 +163,6 @@ int PldmMessagePollEvent::pldmPollForEventMessage(uint8_t TID,
         }
     }
 #endif
-
-    return data.size();
 }
 
-
 } // namespace pldm
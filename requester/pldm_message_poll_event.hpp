@@ -6,8 +6,11 @@
 
 #include "common/types.hpp"
 #include "common/utils.hpp"
+#include "cper.hpp"
 #include "event_hander_interface.hpp"
+#include "fault_log_writer.hpp"
 #include "libpldmresponder/event_parser.hpp"
+#include "pldmd/dbus_impl_debug.hpp"
 #include "requester/handler.hpp"
 
 #include <systemd/sd-journal.h>
@@ -20,6 +23,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace pldm
@@ -44,6 +48,23 @@ class PldmMessagePollEvent : public EventHandlerInterface
   private:
     int pldmPollForEventMessage(uint8_t TID, uint8_t eventClass,
                                 uint16_t eventID, std::vector<uint8_t> data);
+
+    /** @brief Create the SEL and Redfish logs of a CPER record written to
+     *         the fault log directory
+     *
+     *  @param[in] TID - terminus the record came from
+     *  @param[in] eventID - event ID of the record
+     *  @param[in] primaryLogId - name of the record file
+     *  @param[in] ampHdr - Ampere specific header decoded from the record
+     */
+    void logCperRecord(uint8_t TID, uint16_t eventID, std::string primaryLogId,
+                       AmpereSpecData ampHdr);
+
+    /** @brief Writes the CPER records off the event loop */
+    std::unique_ptr<FaultLogWriter> cperWriter;
+
+    /** @brief Counters of the CPER writer */
+    std::unique_ptr<pldm::dbus_api::DebugStats> cperWriterStats;
 };
 
 } // namespace pldm
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "common/histogram.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+namespace pldm
+{
+
+/** @class RasEventScheduler
+ *
+ *  Orders the RAS event IDs a terminus signals before they are fetched with
+ *  PollForPlatformEventMessage. Each priority has its own FIFO, the head is
+ *  taken from the highest priority which is not empty, and a set of the
+ *  queued IDs rejects duplicates in constant time. The time each event
+ *  waited in the queue is kept in a histogram per priority.
+ */
+class RasEventScheduler
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+    using Counters = std::map<std::string, uint64_t>;
+
+    /** @brief Priorities, highest first */
+    enum class Priority : uint8_t
+    {
+        Bert = 0,
+        Overflow,
+        Critical,
+    };
+
+    struct Event
+    {
+        uint16_t id;
+        Priority priority;
+    };
+
+    /** @brief Constructor
+     *
+     *  @param[in] maxQueued - number of events each priority can queue
+     */
+    explicit RasEventScheduler(size_t maxQueued) : maxQueued(maxQueued) {}
+
+    /** @brief Queue an event
+     *
+     *  @param[in] id - event ID
+     *  @param[in] priority - priority of the event
+     *  @param[in] now - time the event was signalled
+     *
+     *  @return 0 on success, -1 if the queue is full, -2 if the event is
+     *          already queued
+     */
+    int push(uint16_t id, Priority priority,
+             Clock::time_point now = Clock::now())
+    {
+        auto& level = levels[static_cast<size_t>(priority)];
+        if (!queuedIds.emplace(key(id, priority)).second)
+        {
+            level.duplicates++;
+            return -2;
+        }
+        if (level.queue.size() >= maxQueued)
+        {
+            queuedIds.erase(key(id, priority));
+            level.dropped++;
+            return -1;
+        }
+        level.queue.push_back({id, now});
+        level.enqueued++;
+        level.maxDepth = std::max<uint64_t>(level.maxDepth, level.queue.size());
+        return 0;
+    }
+
+    /** @brief Get the event to serve next, if any */
+    std::optional<Event> front() const
+    {
+        for (size_t i = 0; i < levels.size(); i++)
+        {
+            if (!levels[i].queue.empty())
+            {
+                return Event{levels[i].queue.front().id,
+                             static_cast<Priority>(i)};
+            }
+        }
+        return std::nullopt;
+    }
+
+    /** @brief Remove the oldest event of a priority and record how long it
+     *         was queued
+     *
+     *  @param[in] priority - priority of the event
+     *  @param[in] now - time the event is served
+     */
+    void pop(Priority priority, Clock::time_point now = Clock::now())
+    {
+        auto& level = levels[static_cast<size_t>(priority)];
+        if (level.queue.empty())
+        {
+            return;
+        }
+        auto& entry = level.queue.front();
+        level.latencies.record(now - entry.queued);
+        level.served++;
+        queuedIds.erase(key(entry.id, priority));
+        level.queue.pop_front();
+    }
+
+    /** @brief Check if no event is queued */
+    bool empty() const
+    {
+        return queuedIds.empty();
+    }
+
+    /** @brief Get the number of events queued with a priority */
+    size_t size(Priority priority) const
+    {
+        return levels[static_cast<size_t>(priority)].queue.size();
+    }
+
+    /** @brief Drop every queued event, the counters are kept */
+    void clear()
+    {
+        for (auto& level : levels)
+        {
+            level.queue.clear();
+        }
+        queuedIds.clear();
+    }
+
+    /** @brief Get the queue depths, counts and latency histograms of each
+     *         priority
+     */
+    Counters getCounters() const
+    {
+        static constexpr std::array<const char*, priorities> names = {
+            "Bert", "Overflow", "Critical"};
+        Counters counters;
+        for (size_t i = 0; i < levels.size(); i++)
+        {
+            const auto& level = levels[i];
+            std::string prefix = std::string(names[i]) + ".";
+            counters[prefix + "Queued"] = level.queue.size();
+            counters[prefix + "MaxQueued"] = level.maxDepth;
+            counters[prefix + "Enqueued"] = level.enqueued;
+            counters[prefix + "Served"] = level.served;
+            counters[prefix + "Duplicates"] = level.duplicates;
+            counters[prefix + "Dropped"] = level.dropped;
+            counters[prefix + "P50LatencyUs"] =
+                level.latencies.getPercentile(50);
+            counters[prefix + "P99LatencyUs"] =
+                level.latencies.getPercentile(99);
+            for (size_t bucket = 0; bucket < level.latencies.buckets; bucket++)
+            {
+                auto count = level.latencies.getBucketCount(bucket);
+                if (count)
+                {
+                    auto limit = level.latencies.getBucketLimit(bucket);
+                    counters[prefix + "LatencyUsBelow" +
+                             std::to_string(limit)] = count;
+                }
+            }
+        }
+        return counters;
+    }
+
+  private:
+    static constexpr size_t priorities = 3;
+
+    struct Entry
+    {
+        uint16_t id;
+        Clock::time_point queued;
+    };
+
+    struct Level
+    {
+        std::deque<Entry> queue;
+        uint64_t enqueued = 0;
+        uint64_t served = 0;
+        uint64_t duplicates = 0;
+        uint64_t dropped = 0;
+        uint64_t maxDepth = 0;
+        pldm::utils::Log2Histogram latencies;
+    };
+
+    static uint32_t key(uint16_t id, Priority priority)
+    {
+        return static_cast<uint32_t>(priority) << 16 | id;
+    }
+
+    const size_t maxQueued;
+    std::array<Level, priorities> levels;
+    /** @brief IDs of the queued events, keyed with their priority */
+    std::unordered_set<uint32_t> queuedIds;
+};
+
+} // namespace pldm
@@ -0,0 +1,324 @@
+#pragma once
+
+#include <libpldm/platform.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <vector>
+
+namespace pldm
+{
+
+namespace terminus
+{
+
+/** @brief Get the polling period of a sensor in polling ticks
+ *
+ *  @details Sensors whose occurrence rate is in seconds or faster are read
+ *  every polling round. Slower sensors, such as inventory counters and energy
+ *  accumulators, are read once per minute or once per hour.
+ *
+ *  @param[in] rateUnit - occurrence rate of the sensor or rate unit of the
+ *                        effecter from its PDR
+ *  @param[in] interval - sensor polling interval
+ *
+ *  @return the number of polling rounds between two readings of the sensor
+ */
+inline uint32_t pollPeriodTicks(uint8_t rateUnit,
+                                std::chrono::milliseconds interval)
+{
+    std::chrono::milliseconds period{0};
+    switch (rateUnit)
+    {
+        case PLDM_RATE_UNIT_PER_MINUTE:
+            period = std::chrono::minutes(1);
+            break;
+        case PLDM_RATE_UNIT_PER_HOUR:
+        case PLDM_RATE_UNIT_PER_DAY:
+        case PLDM_RATE_UNIT_PER_WEEK:
+        case PLDM_RATE_UNIT_PER_MONTH:
+        case PLDM_RATE_UNIT_PER_YEAR:
+            period = std::chrono::hours(1);
+            break;
+        default:
+            return 1;
+    }
+
+    if (interval.count() <= 0)
+    {
+        return 1;
+    }
+
+    /* Round up so a sensor is never read more often than its rate */
+    auto ticks = (period.count() + interval.count() - 1) / interval.count();
+    return std::max<uint32_t>(1, static_cast<uint32_t>(ticks));
+}
+
+/** @brief Get the number of polling rounds between the liveness readings of
+ *         a sensor which pushes its value in sensor events
+ *
+ *  @param[in] liveness - longest time without sensor event before the sensor
+ *                        is read
+ *  @param[in] interval - sensor polling interval
+ *
+ *  @return the number of polling rounds, 0 if liveness readings are disabled
+ */
+inline uint32_t livenessPeriodTicks(std::chrono::milliseconds liveness,
+                                    std::chrono::milliseconds interval)
+{
+    if (liveness.count() <= 0)
+    {
+        return 0;
+    }
+    if (interval.count() <= 0)
+    {
+        return 1;
+    }
+    auto ticks = (liveness.count() + interval.count() - 1) / interval.count();
+    return std::max<uint32_t>(1, static_cast<uint32_t>(ticks));
+}
+
+/** @brief Decode the present reading of a numeric sensor event
+ *
+ *  @param[in] sensorDataSize - data size of the reading
+ *  @param[in] presentReading - reading zero extended to 32 bits
+ *
+ *  @return the reading, std::nullopt if the data size is invalid
+ */
+inline std::optional<double> decodeEventReading(uint8_t sensorDataSize,
+                                                uint32_t presentReading)
+{
+    switch (sensorDataSize)
+    {
+        case PLDM_SENSOR_DATA_SIZE_UINT8:
+            return static_cast<uint8_t>(presentReading);
+        case PLDM_SENSOR_DATA_SIZE_SINT8:
+            return static_cast<int8_t>(presentReading);
+        case PLDM_SENSOR_DATA_SIZE_UINT16:
+            return static_cast<uint16_t>(presentReading);
+        case PLDM_SENSOR_DATA_SIZE_SINT16:
+            return static_cast<int16_t>(presentReading);
+        case PLDM_SENSOR_DATA_SIZE_UINT32:
+            return static_cast<uint32_t>(presentReading);
+        case PLDM_SENSOR_DATA_SIZE_SINT32:
+            return static_cast<int32_t>(presentReading);
+        default:
+            return std::nullopt;
+    }
+}
+
+/** @class SensorPollScheduler
+ *
+ *  Timing wheel of the sensors of one terminus keyed on the polling round each
+ *  sensor is next due. Every polling round advances the wheel by one slot and
+ *  only the sensors in that slot are read, each of them is then rescheduled
+ *  one polling period later. A sensor which pushes its value in sensor events
+ *  is postponed by each event, it is only read when its events stop and then
+ *  goes back to its polling period.
+ *
+ *  @tparam Key - sensor key type
+ */
+template <typename Key>
+class SensorPollScheduler
+{
+  public:
+    /** @brief Constructor
+     *
+     *  @param[in] maxPeriod - longest polling period in ticks to support
+     */
+    explicit SensorPollScheduler(uint32_t maxPeriod) :
+        wheel(std::max<uint32_t>(maxPeriod, 1) + 1)
+    {}
+
+    /** @brief Add a sensor, the sensor is due in the current polling round
+     *
+     *  @param[in] key - sensor key
+     *  @param[in] period - polling period of the sensor in ticks
+     */
+    void add(const Key& key, uint32_t period)
+    {
+        period = std::clamp<uint32_t>(period, 1, wheel.size() - 1);
+        remove(key);
+        entries[key] = Entry{period, tick, tick, false};
+        wheel[tick % wheel.size()].emplace_back(key);
+    }
+
+    /** @brief Postpone the next reading of a sensor which pushed its value,
+     *  the sensor keeps its polling period
+     *
+     *  @details A sensor postponed again before it is due keeps its slot and
+     *  is moved to the new due round when its slot comes around. Once read,
+     *  the sensor is due again one polling period later.
+     *
+     *  @param[in] key - sensor key
+     *  @param[in] delay - ticks before the sensor is read, counted from the
+     *                     last polling round
+     */
+    void postpone(const Key& key, uint32_t delay)
+    {
+        auto it = entries.find(key);
+        if (it == entries.end())
+        {
+            return;
+        }
+        auto& entry = it->second;
+        delay = std::clamp<uint32_t>(delay, 1, wheel.size() - 1);
+        entry.due = tick + delay - 1;
+        if (!entry.eventDriven)
+        {
+            entry.eventDriven = true;
+            eventDriven++;
+        }
+        if (entry.due < entry.slot)
+        {
+            entry.slot = entry.due;
+            wheel[entry.slot % wheel.size()].emplace_back(key);
+        }
+    }
+
+    /** @brief Remove a sensor from the schedule
+     *
+     *  @param[in] key - sensor key
+     */
+    void remove(const Key& key)
+    {
+        /* The stale slot entry is dropped when its slot comes around */
+        auto it = entries.find(key);
+        if (it == entries.end())
+        {
+            return;
+        }
+        if (it->second.eventDriven)
+        {
+            eventDriven--;
+        }
+        entries.erase(it);
+    }
+
+    /** @brief Check whether a sensor is scheduled
+     *
+     *  @param[in] key - sensor key
+     */
+    bool contains(const Key& key) const
+    {
+        return entries.contains(key);
+    }
+
+    /** @brief Get the keys of the scheduled sensors */
+    std::vector<Key> keys() const
+    {
+        std::vector<Key> scheduled;
+        scheduled.reserve(entries.size());
+        for (const auto& [key, entry] : entries)
+        {
+            scheduled.emplace_back(key);
+        }
+        return scheduled;
+    }
+
+    /** @brief Get the number of scheduled sensors */
+    size_t size() const
+    {
+        return entries.size();
+    }
+
+    /** @brief Get the number of sensors postponed by their sensor events
+     *         since they were last read
+     */
+    size_t getEventDriven() const
+    {
+        return eventDriven;
+    }
+
+    /** @brief Advance the wheel by one polling round
+     *
+     *  @return the sensors due in this polling round
+     */
+    std::vector<Key> advance()
+    {
+        std::vector<Key> due;
+        std::vector<Key> postponed;
+        auto& slot = wheel[tick % wheel.size()];
+        for (const auto& key : slot)
+        {
+            auto it = entries.find(key);
+            if (it == entries.end() || it->second.slot != tick)
+            {
+                continue;
+            }
+            auto& entry = it->second;
+            if (entry.due > tick)
+            {
+                entry.slot = entry.due;
+                postponed.emplace_back(key);
+                continue;
+            }
+            entry.due = tick + entry.period;
+            entry.slot = entry.due;
+            /* No event postponed the reading, back to polling */
+            if (entry.eventDriven)
+            {
+                entry.eventDriven = false;
+                eventDriven--;
+            }
+            due.emplace_back(key);
+        }
+        slot.clear();
+
+        for (const auto& key : due)
+        {
+            wheel[entries.at(key).slot % wheel.size()].emplace_back(key);
+        }
+        for (const auto& key : postponed)
+        {
+            wheel[entries.at(key).slot % wheel.size()].emplace_back(key);
+        }
+
+        dueReads += due.size();
+        skippedReads += entries.size() - due.size();
+        tick++;
+
+        return due;
+    }
+
+    /** @brief Get the number of readings scheduled so far */
+    uint64_t getDueReads() const
+    {
+        return dueReads;
+    }
+
+    /** @brief Get the number of readings saved by the slower rate classes */
+    uint64_t getSkippedReads() const
+    {
+        return skippedReads;
+    }
+
+  private:
+    struct Entry
+    {
+        uint32_t period;  //!< polling period in ticks
+        uint64_t due;     //!< tick the sensor is next due
+        uint64_t slot;    //!< tick of the wheel slot holding the sensor
+        bool eventDriven; //!< postponed by sensor events since last read
+    };
+
+    /** @brief Current polling round */
+    uint64_t tick = 0;
+    /** @brief Wheel slots, each holds the sensors due in that slot */
+    std::vector<std::vector<Key>> wheel;
+    /** @brief Scheduled sensors */
+    std::map<Key, Entry> entries;
+    /** @brief Number of readings scheduled */
+    uint64_t dueReads = 0;
+    /** @brief Number of readings skipped because the sensor was not due */
+    uint64_t skippedReads = 0;
+    /** @brief Number of event driven sensors */
+    size_t eventDriven = 0;
+};
+
+} // namespace terminus
+
+} // namespace pldm
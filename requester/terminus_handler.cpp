@@ -4,7 +4,10 @@
 
 #include <sdeventplus/source/time.hpp>
 
+#include <algorithm>
+#include <cctype>
 #include <chrono>
+#include <filesystem>
 
 namespace pldm
 {
@@ -27,9 +30,27 @@ TerminusHandler::TerminusHandler(
     bus(bus), event(event), repo(repo), entityTree(entityTree),
     bmcEntityTree(bmcEntityTree), handler(handler),
     instanceIdDb(instanceIdDb), _state(),
+    pollScheduler(pollPeriodTicks(
+        PLDM_RATE_UNIT_PER_HOUR,
+        std::chrono::milliseconds(POLL_SENSOR_TIMER_INTERVAL))),
     _timer(event, std::bind(&TerminusHandler::pollSensors, this)),
-    _timer2(event, std::bind(&TerminusHandler::readSensor, this))
-{}
+    pollingWindow(std::min<size_t>(SENSOR_POLLING_WINDOW,
+                                   handler->getInflightWindow()))
+{
+    try
+    {
+        pollingStats = std::make_unique<pldm::dbus_api::DebugStats>(
+            bus,
+            std::string(pldm::dbus_api::DebugStats::basePath) + "/terminus_" +
+                std::to_string(eid),
+            std::bind(&TerminusHandler::getPollingCounters, this));
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Failed to create the polling debug counters of eid "
+                  << unsigned(eid) << ", " << e.what() << std::endl;
+    }
+}
 
 TerminusHandler::~TerminusHandler()
 {
@@ -45,6 +66,7 @@ TerminusHandler::~TerminusHandler()
     this->_auxNameMaps.clear();
     this->parents.clear();
     pldm_pdr_remove_remote_pdrs(repo);
+    pldm::utils::pdrRepoChanged(repo);
     pldm_entity_association_tree_destroy_root(entityTree);
     pldm_entity_association_tree_copy_root(bmcEntityTree, entityTree);
 }
@@ -57,23 +79,27 @@ requester::Coroutine TerminusHandler::discoveryTerminus()
      *
      * 1.1 Get supported PLDM Types
      *
-     * 1.2. If PLDM for BIOS control and configuration is supported
-     * 1.2.1 Set the date and time using the SetDateTime command
-     *
-     * 1.3. If PLDM Base Type is supported, get PLDM Base commands
-     * 1.3.1 Get TID
-     * 1.3.2 Get PLDM Commands
+     * 1.2 The stages below only depend on the supported types, they are
+     * started together and their requests are windowed by the request handler
+     * 1.2.1 If PLDM Base Type is supported, get the PLDM commands of every
+     * supported type and the TID
+     * 1.2.2 If PLDM for BIOS control and configuration is supported, set the
+     * date and time using the SetDateTime command
      *
-     * 1.4. If FRU Type is supported, issue these FRU commands
-     * 1.4.1 Get FRU Meta data via GetFRURecordTableMetadata
-     * 1.4.2 Get FRU Table data via GetFRURecordTable
+     * 1.3 If FRU Type is supported, once the TID is known, get FRU Meta data
+     * via GetFRURecordTableMetadata then FRU Table data via GetFRURecordTable
+     * while the stages below run
      *
-     * 1.5. If PLDM Platform Type is supported, get PLDM Platform commands
-     * 1.5.1 Prepare to receive event notification SetEventReceiver
-     * 1.5.2 Get all Sensor/Effecter/Association information via GetPDR command
+     * 1.4. If PLDM Platform Type is supported, once the commands are known
+     * 1.4.1 Get all Sensor/Effecter/Association information via GetPDR command
+     * 1.4.2 Prepare to receive event notification SetEventReceiver
      *
      */
-    auto rc = co_await getPLDMTypes();
+    auto discoveryStart = std::chrono::steady_clock::now();
+    discoveryStageTimes.clear();
+
+    auto rc = co_await timeDiscoveryStage("Types",
+                                          &TerminusHandler::getPLDMTypes);
     if (rc)
     {
         std::cerr << "Failed to getPLDMTypes, rc=" << unsigned(rc) << std::endl;
@@ -82,64 +108,57 @@ requester::Coroutine TerminusHandler::discoveryTerminus()
     /* Received the response, terminus is on */
     this->responseReceived = true;
 
+    std::optional<requester::Coroutine> commandsStage;
+    std::optional<requester::Coroutine> tidStage;
+    std::optional<requester::Coroutine> dateTimeStage;
+    std::optional<requester::Coroutine> fruStage;
     if (supportPLDMType(PLDM_BASE))
     {
-        rc = co_await getPLDMCommands();
-        if (rc)
-        {
-            std::cerr << "Failed to getPLDMCommands, rc=" << unsigned(rc)
-                      << std::endl;
-        }
+        commandsStage.emplace(timeDiscoveryStage(
+            "Commands", &TerminusHandler::getPLDMCommands));
+        tidStage.emplace(timeDiscoveryStage("TID", &TerminusHandler::getTID));
     }
-
-    if (supportPLDMType(PLDM_BASE))
+    if (supportPLDMType(PLDM_BIOS))
     {
-        rc = co_await getTID();
-        if (rc)
-        {
-            std::cerr << "Failed to getTID, rc=" << unsigned(rc) << std::endl;
-        }
+        dateTimeStage.emplace(
+            timeDiscoveryStage("DateTime", &TerminusHandler::setDateTime));
     }
 
-    if (supportPLDMType(PLDM_BIOS))
+    /* The PDRs need the supported commands and the TID */
+    if (commandsStage)
     {
-        rc = co_await setDateTime();
+        rc = co_await *commandsStage;
         if (rc)
         {
-            std::cerr << "Failed to setDateTime, rc=" << unsigned(rc)
+            std::cerr << "Failed to getPLDMCommands, rc=" << unsigned(rc)
                       << std::endl;
         }
     }
-
-    uint16_t totalTableRecords = 0;
-    if (supportPLDMType(PLDM_FRU))
+    if (tidStage)
     {
-        rc = co_await getFRURecordTableMetadata(&totalTableRecords);
+        rc = co_await *tidStage;
         if (rc)
         {
-            std::cerr << "Failed to getFRURecordTableMetadata, "
-                      << "rc=" << unsigned(rc) << std::endl;
-        }
-        if (!totalTableRecords)
-        {
-            std::cerr << "Number of record table is not correct." << std::endl;
+            std::cerr << "Failed to getTID, rc=" << unsigned(rc) << std::endl;
         }
     }
 
-    if ((totalTableRecords != 0) && supportPLDMType(PLDM_FRU))
+    /* Check whether the terminus is removed when discoverying */
+    if (stopTerminusPolling)
     {
-        rc = co_await getFRURecordTable(totalTableRecords);
-        if (rc)
+        /* Don't leave a stage running against the removed terminus, the FRU
+         * stage is not started yet */
+        if (dateTimeStage)
         {
-            std::cerr << "Failed to getFRURecordTable, "
-                      << "rc=" << unsigned(rc) << std::endl;
+            co_await *dateTimeStage;
         }
+        co_return PLDM_SUCCESS;
     }
 
-    /* Check whether the terminus is removed when discoverying */
-    if (stopTerminusPolling)
+    /* The FRU records are parsed with the TID */
+    if (supportPLDMType(PLDM_FRU))
     {
-        co_return PLDM_SUCCESS;
+        fruStage.emplace(timeDiscoveryStage("FRU", &TerminusHandler::getFRU));
     }
 
     if (supportPLDMType(PLDM_PLATFORM))
@@ -151,10 +170,10 @@ requester::Coroutine TerminusHandler::discoveryTerminus()
                       << getCurrentSystemTime() << std::endl;
         }
 
-        rc = co_await getDevPDR(0);
+        rc = co_await timeDiscoveryStage("PDR", &TerminusHandler::getPDRs);
         if (rc)
         {
-            std::cerr << "Failed to setEventReceiver, rc=" << unsigned(rc)
+            std::cerr << "Failed to getDevPDR, rc=" << unsigned(rc)
                       << std::endl;
         }
         else
@@ -183,6 +202,9 @@ requester::Coroutine TerminusHandler::discoveryTerminus()
             if (_state.size() > 0)
             {
                 createdDbusObject = true;
+                discoveryStageTimes["FirstSensor"] =
+                    std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - discoveryStart);
             }
             updateSensorKeys();
         }
@@ -190,7 +212,8 @@ requester::Coroutine TerminusHandler::discoveryTerminus()
 
     if (supportPLDMType(PLDM_PLATFORM))
     {
-        rc = co_await setEventReceiver();
+        rc = co_await timeDiscoveryStage("EventReceiver",
+                                         &TerminusHandler::setEventReceiver);
         if (rc)
         {
             std::cerr << "Failed to setEventReceiver, rc=" << unsigned(rc)
@@ -202,9 +225,76 @@ requester::Coroutine TerminusHandler::discoveryTerminus()
     eventDataHndl = std::make_shared<PldmMessagePollEvent>(eid, event, bus,
                                                            instanceIdDb, handler);
 
+    if (dateTimeStage)
+    {
+        rc = co_await *dateTimeStage;
+        if (rc)
+        {
+            std::cerr << "Failed to setDateTime, rc=" << unsigned(rc)
+                      << std::endl;
+        }
+    }
+    if (fruStage)
+    {
+        rc = co_await *fruStage;
+        if (rc)
+        {
+            std::cerr << "Failed to get the FRU record table, rc="
+                      << unsigned(rc) << std::endl;
+        }
+    }
+
+    discoveryStageTimes["Total"] =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - discoveryStart);
+    std::cerr << "Discovery Terminus: " << unsigned(eid) << " done in";
+    for (const auto& [stage, elapsed] : discoveryStageTimes)
+    {
+        std::cerr << " " << stage << "=" << elapsed.count() << "us";
+    }
+    std::cerr << std::endl;
+
     co_return PLDM_SUCCESS;
 }
 
+requester::Coroutine TerminusHandler::timeDiscoveryStage(
+    std::string stage,
+    requester::Coroutine (TerminusHandler::*discoveryStage)())
+{
+    /* The stages start running when called, take the time before */
+    auto start = std::chrono::steady_clock::now();
+    auto rc = co_await (this->*discoveryStage)();
+    discoveryStageTimes[stage] =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start);
+    co_return rc;
+}
+
+requester::Coroutine TerminusHandler::getFRU()
+{
+    uint16_t totalTableRecords = 0;
+    auto rc = co_await getFRURecordTableMetadata(&totalTableRecords);
+    if (rc)
+    {
+        std::cerr << "Failed to getFRURecordTableMetadata, "
+                  << "rc=" << unsigned(rc) << std::endl;
+        co_return rc;
+    }
+    if (!totalTableRecords)
+    {
+        std::cerr << "Number of record table is not correct." << std::endl;
+        co_return PLDM_SUCCESS;
+    }
+
+    rc = co_await getFRURecordTable(totalTableRecords);
+    if (rc)
+    {
+        std::cerr << "Failed to getFRURecordTable, "
+                  << "rc=" << unsigned(rc) << std::endl;
+    }
+    co_return rc;
+}
+
 bool TerminusHandler::supportPLDMType(const uint8_t type)
 {
     if (devInfo.supportedTypes[type / 8].byte & (1 << (type % 8)))
@@ -320,21 +410,29 @@ requester::Coroutine TerminusHandler::getPLDMCommands()
     std::cerr << "Discovery Terminus: " << unsigned(eid)
               << " get the supported PLDM Types." << std::endl;
 
-    uint8_t type = PLDM_BASE;
-    while ((type < PLDM_MAX_TYPES) && supportPLDMType(type))
+    /* The types are independent, send the requests of all of them at once */
+    std::vector<std::pair<uint8_t, requester::Coroutine>> pending;
+    for (uint8_t type = PLDM_BASE; type < PLDM_MAX_TYPES; type++)
     {
-        auto rc = co_await getPLDMCommand(type);
+        if (supportPLDMType(type))
+        {
+            pending.emplace_back(type, getPLDMCommand(type));
+        }
+    }
+
+    for (auto& [type, command] : pending)
+    {
+        auto rc = co_await command;
         if (rc)
         {
             std::cerr << "Failed to getPLDMCommand, Type=" << unsigned(type)
                       << " rc =" << unsigned(rc) << std::endl;
         }
-        type++;
     }
     co_return PLDM_SUCCESS;
 }
 
-requester::Coroutine TerminusHandler::getPLDMCommand(const uint8_t& pldmTypeIdx)
+requester::Coroutine TerminusHandler::getPLDMCommand(uint8_t pldmTypeIdx)
 {
     auto instanceId = instanceIdDb.next(eid);
     Request requestMsg(sizeof(pldm_msg_hdr) + PLDM_GET_COMMANDS_REQ_BYTES);
@@ -402,6 +500,16 @@ requester::Coroutine TerminusHandler::getPLDMCommand(const uint8_t& pldmTypeIdx)
     co_return cc;
 }
 
+void TerminusHandler::setTid(uint8_t tid)
+{
+    auto oldTid = devInfo.tid;
+    devInfo.tid = tid;
+    if (oldTid != tid && tidChangeHandler)
+    {
+        tidChangeHandler(oldTid, tid);
+    }
+}
+
 requester::Coroutine TerminusHandler::getTID()
 {
     std::cerr << "Discovery Terminus: " << unsigned(eid) << " get TID."
@@ -454,11 +562,11 @@ requester::Coroutine TerminusHandler::getTID()
         std::cerr << "Faile to decode_get_tid_resp, Message Error: "
                   << "rc=" << unsigned(rc) << ",cc=" << unsigned(cc)
                   << std::endl;
-        devInfo.tid = 0xFF;
+        setTid(PLDM_TID_RESERVED);
         co_return cc;
     }
 
-    devInfo.tid = tid;
+    setTid(tid);
     std::cerr << "Discovery Terminus: EID=" << unsigned(eid) << " TID="
               << unsigned(tid) << std::endl;
 
@@ -925,6 +1033,138 @@ requester::Coroutine
     co_return cc;
 }
 
+requester::Coroutine TerminusHandler::getPDRs()
+{
+    /* Replay the PDRs cached on the last discovery when the repository
+     * of the terminus is unchanged, fetch them otherwise */
+    uint8_t rc = PLDM_SUCCESS;
+    bool cachedPDRs = false;
+    pdrRepoInfo.reset();
+    if (pdrCache &&
+        supportPLDMCommand(PLDM_PLATFORM, PLDM_GET_PDR_REPOSITORY_INFO))
+    {
+        PDRRepositoryInfo info{};
+        rc = co_await getPDRRepositoryInfo(&info);
+        if (rc)
+        {
+            std::cerr << "Failed to getPDRRepositoryInfo, rc="
+                      << unsigned(rc) << std::endl;
+        }
+        else if (info.hasUpdateTime())
+        {
+            pdrRepoInfo = info;
+        }
+    }
+
+    if (pdrRepoInfo)
+    {
+        auto records = pdrCache->load(*pdrRepoInfo);
+        if (records)
+        {
+            std::cerr << "Discovery Terminus: " << unsigned(eid)
+                      << " use " << records->size() << " cached PDRs."
+                      << std::endl;
+            for (const auto& [recordHandle, pdr] : *records)
+            {
+                processPDR(recordHandle, pdr);
+            }
+            cachedPDRs = true;
+            rc = PLDM_SUCCESS;
+        }
+    }
+
+    if (!cachedPDRs)
+    {
+        fetchedPDRs.clear();
+        rc = co_await getDevPDR(0);
+        /* The repository info is dropped when the repository changed
+         * while it was fetched */
+        if (!rc && pdrRepoInfo && !stopTerminusPolling &&
+            !pdrCache->store(*pdrRepoInfo, fetchedPDRs))
+        {
+            std::cerr << "Failed to cache the PDRs of EID="
+                      << unsigned(eid) << std::endl;
+        }
+        fetchedPDRs.clear();
+    }
+
+    co_return rc;
+}
+
+requester::Coroutine
+    TerminusHandler::getPDRRepositoryInfo(PDRRepositoryInfo* info)
+{
+    std::cerr << "Discovery Terminus: " << unsigned(eid)
+              << " get PDR repository info." << std::endl;
+    auto instanceId = instanceIdDb.next(eid);
+    Request requestMsg(sizeof(pldm_msg_hdr));
+    auto request = reinterpret_cast<pldm_msg*>(requestMsg.data());
+    pldm_header_info header{};
+    header.msg_type = PLDM_REQUEST;
+    header.instance = instanceId;
+    header.pldm_type = PLDM_PLATFORM;
+    header.command = PLDM_GET_PDR_REPOSITORY_INFO;
+    auto rc = pack_pldm_header(&header, &request->hdr);
+    if (rc != PLDM_SUCCESS)
+    {
+        instanceIdDb.free(eid, instanceId);
+        std::cerr << "Failed to pack GetPDRRepositoryInfo header, rc = "
+                  << unsigned(rc) << std::endl;
+        co_return rc;
+    }
+
+    Response responseMsg{};
+    rc = co_await requester::sendRecvPldmMsg(*handler, eid, requestMsg,
+                                             responseMsg);
+    if (rc)
+    {
+        std::cerr << "Failed to send sendRecvPldmMsg, EID=" << unsigned(eid)
+                  << ", instanceId=" << unsigned(instanceId)
+                  << ", type=" << unsigned(PLDM_PLATFORM)
+                  << ", cmd= " << unsigned(PLDM_GET_PDR_REPOSITORY_INFO)
+                  << ", rc=" << unsigned(rc) << std::endl;
+        co_return rc;
+    }
+
+    auto respMsgLen = responseMsg.size() - sizeof(struct pldm_msg_hdr);
+    auto response = reinterpret_cast<pldm_msg*>(responseMsg.data());
+    if (response == nullptr || !respMsgLen)
+    {
+        std::cerr << "No response received for sendRecvPldmMsg, EID="
+                  << unsigned(eid) << ", instanceId=" << unsigned(instanceId)
+                  << ", type=" << unsigned(PLDM_PLATFORM)
+                  << ", cmd= " << unsigned(PLDM_GET_PDR_REPOSITORY_INFO)
+                  << std::endl;
+        co_return PLDM_ERROR;
+    }
+
+    uint8_t cc = 0;
+    uint8_t repositoryState = 0;
+    uint8_t dataTransferHandleTimeout = 0;
+    rc = decode_get_pdr_repository_info_resp(
+        response, respMsgLen, &cc, &repositoryState, info->updateTime.data(),
+        info->oemUpdateTime.data(), &info->recordCount, &info->repositorySize,
+        &info->largestRecordSize, &dataTransferHandleTimeout);
+    if (rc != PLDM_SUCCESS || cc != PLDM_SUCCESS)
+    {
+        std::cerr << "Failed to decode_get_pdr_repository_info_resp, "
+                  << "rc=" << unsigned(rc) << ", cc=" << unsigned(cc)
+                  << std::endl;
+        co_return rc != PLDM_SUCCESS ? rc : cc;
+    }
+
+    /* A repository being updated can't be matched against the cache */
+    if (repositoryState != PLDM_AVAILABLE)
+    {
+        std::cerr << "PDR repository of EID=" << unsigned(eid)
+                  << " is not available, state=" << unsigned(repositoryState)
+                  << std::endl;
+        co_return PLDM_ERROR_NOT_READY;
+    }
+
+    co_return PLDM_SUCCESS;
+}
+
 requester::Coroutine TerminusHandler::getDevPDR(uint32_t nextRecordHandle)
 {
     std::cerr << "Discovery Terminus: " << unsigned(eid)
@@ -1010,10 +1250,7 @@ requester::Coroutine TerminusHandler::processDevPDRs(mctp_eid_t& /*eid*/,
                                                      uint32_t* nextRecordHandle,
                                                      uint32_t recordHandle)
 {
-    uint8_t tlEid = 0;
-    bool tlValid = true;
     uint32_t rh = 0;
-    uint8_t tid = 0;
 
     uint8_t completionCode{};
     uint32_t nextDataTransferHandle{};
@@ -1083,11 +1320,24 @@ requester::Coroutine TerminusHandler::processDevPDRs(mctp_eid_t& /*eid*/,
         rh = pdrHdr->record_handle;
     }
 
+    fetchedPDRs.emplace_back(rh, pdr);
+    processPDR(rh, pdr);
+
+    co_return PLDM_SUCCESS;
+}
+
+void TerminusHandler::processPDR(uint32_t rh, const std::vector<uint8_t>& pdr)
+{
+    uint8_t tlEid = 0;
+    bool tlValid = true;
+    uint8_t tid = 0;
+
+    auto pdrHdr = reinterpret_cast<const pldm_pdr_hdr*>(pdr.data());
     if (pdrHdr->type == PLDM_PDR_ENTITY_ASSOCIATION)
     {
         /* Temporary remove merge Entity Association feature */
         this->mergeEntityAssociations(pdr);
-        co_return PLDM_SUCCESS;
+        return;
     }
 
     if (pdrHdr->type == PLDM_TERMINUS_LOCATOR_PDR)
@@ -1133,11 +1383,10 @@ requester::Coroutine TerminusHandler::processDevPDRs(mctp_eid_t& /*eid*/,
     }
     else
     {
-        pldm_pdr_add_check(repo, pdr.data(), respCount, true,
+        pldm_pdr_add_check(repo, pdr.data(), pdr.size(), true,
                            terminusHandle, &rh);
+        pldm::utils::pdrRepoChanged(repo);
     }
-
-    co_return PLDM_SUCCESS;
 }
 
 void TerminusHandler::mergeEntityAssociations(const std::vector<uint8_t>& pdr)
@@ -1182,6 +1431,7 @@ void TerminusHandler::mergeEntityAssociations(const std::vector<uint8_t>& pdr)
                                                             &entities,
                                                             numEntities, true,
                                                             terminusHandle);
+            pldm::utils::pdrRepoChanged(repo);
         }
     }
     free(entities);
@@ -1324,6 +1574,9 @@ void TerminusHandler::createCompactNummericSensorIntf(const PDRList& sensorPDRs)
                 std::make_tuple(pdr->sensor_id, std::move((*object).second));
             auto key = std::make_tuple(eid, pdr->sensor_id, pdr->hdr.type);
 
+            sensorPollPeriods[key] = pollPeriodTicks(
+                sensorInfo.occurrenceRate,
+                std::chrono::milliseconds(POLL_SENSOR_TIMER_INTERVAL));
             _sensorObjects[key] = std::move(sensorObject);
             _state[std::move(key)] = std::move(value);
         }
@@ -1495,6 +1748,9 @@ void TerminusHandler::createNummericEffecterDBusIntf(const PDRList& sensorPDRs)
                 std::make_tuple(pdr->effecter_id, std::move((*object).second));
             auto key = std::make_tuple(eid, pdr->effecter_id, pdr->hdr.type);
 
+            sensorPollPeriods[key] = pollPeriodTicks(
+                sensorInfo.occurrenceRate,
+                std::chrono::milliseconds(POLL_SENSOR_TIMER_INTERVAL));
             _sensorObjects[key] = std::move(sensorObj);
             _effecterLists.emplace_back(key);
             _state[std::move(key)] = std::move(value);
@@ -1579,16 +1835,13 @@ void TerminusHandler::startSensorsPolling()
 {
     readCount = 0;
     continuePollSensor = true;
+    pollingStart = std::chrono::steady_clock::now();
     std::function<void()> pollCallback(
         std::bind(&TerminusHandler::pollSensors, this));
-    std::function<void()> readCallback(
-        std::bind(&TerminusHandler::readSensor, this));
 
     try
     {
         _timer.restart(std::chrono::milliseconds(POLL_SENSOR_TIMER_INTERVAL));
-        _timer2.restart(
-            std::chrono::milliseconds(SLEEP_BETWEEN_GET_SENSOR_READING));
     }
     catch (const std::exception& e)
     {
@@ -1605,7 +1858,6 @@ void TerminusHandler::stopSensorsPolling()
 {
     continuePollSensor = false;
     _timer.setEnabled(false);
-    _timer2.setEnabled(false);
 
     // Set sensors values to Nan and Functional property to false for FANs speeds to be driven max
     for (auto sensorIt = _sensorObjects.begin(); sensorIt != _sensorObjects.end(); ++sensorIt)
@@ -1685,14 +1937,32 @@ void TerminusHandler::pollSensors()
         unavailableSensorKeys.clear();
     }
 
-    this->sensorKey = sensorKeys.begin();
+    sensorKeys = pollScheduler.advance();
     pollingSensors = true;
     readCount++;
+    nextSensorIdx = 0;
+    inflightReadings = 0;
+    pollRoundStart = std::chrono::steady_clock::now();
+
+    if (debugPollSensor)
+    {
+        std::cerr << eidToName.second << ":[" << readCount << "]"
+                  << "Start new pollSensor at " << getCurrentSystemTime()
+                  << std::endl;
+        /* Stop print polling debug after 50 rounds */
+        if (readCount > 50)
+        {
+            debugPollSensor = false;
+        }
+    }
+
+    readSensor();
 
     return;
 }
 
-/** @brief Start reading the sensors info process
+/** @brief Keep up to pollingWindow sensor readings in flight, the next
+ *  reading is sent as soon as a response frees a slot
  */
 void TerminusHandler::readSensor()
 {
@@ -1701,56 +1971,57 @@ void TerminusHandler::readSensor()
         return;
     }
 
-    if (!continuePollSensor)
+    if (!pollingSensors)
     {
         return;
     }
 
-    if (!pollingSensors)
+    while (continuePollSensor && inflightReadings < pollingWindow &&
+           nextSensorIdx < sensorKeys.size())
     {
-        return;
+        auto rc = getSensorReading(sensorKeys[nextSensorIdx++]);
+        if (rc == PLDM_SUCCESS)
+        {
+            inflightReadings++;
+        }
     }
 
-    if (sendingPldmCommand)
+    if (!inflightReadings &&
+        (!continuePollSensor || nextSensorIdx >= sensorKeys.size()))
     {
-        return;
+        finishPollRound();
     }
 
-    if (this->sensorKey == sensorKeys.begin() && debugPollSensor)
+    return;
+}
+
+/** @brief Complete the polling round and report its latency
+ */
+void TerminusHandler::finishPollRound()
+{
+    pollingSensors = false;
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - pollRoundStart);
+    lastPollRoundLatency = elapsed;
+    maxPollRoundLatency = std::max(maxPollRoundLatency, elapsed);
+
+    if (debugPollSensor)
     {
-        startTime = std::chrono::system_clock::now();
+        std::chrono::duration<double> elapsed_seconds = elapsed;
         std::cerr << eidToName.second << ":[" << readCount << "]"
-                  << "Start new pollSensor at " << getCurrentSystemTime()
-                  << std::endl;
-        /* Stop print polling debug after 50 rounds */
-        if (readCount > 50)
-        {
-            debugPollSensor = false;
-        }
+                  << " Finish one pollsensor round of " << nextSensorIdx
+                  << " sensors after " << elapsed_seconds.count() << "s at "
+                  << getCurrentSystemTime() << std::endl;
     }
 
-    if (this->sensorKey != sensorKeys.end())
+    if (elapsed > std::chrono::milliseconds(POLL_SENSOR_TIMER_INTERVAL))
     {
-        getSensorReading(get<1>(*(this->sensorKey)),
-                         get<2>(*(this->sensorKey)));
-    }
-    else
-    {
-        pollingSensors = false;
-
-        if (debugPollSensor)
-        {
-            std::chrono::duration<double> elapsed_seconds =
-                std::chrono::system_clock::now() - startTime;
-            std::cerr << eidToName.second << ":[" << readCount << "]"
-                      << " Finish one pollsensor round after "
-                      << elapsed_seconds.count() << "s at "
-                      << getCurrentSystemTime()
-                      << std::endl;
-        }
+        std::cerr << eidToName.second << ":[" << readCount << "]"
+                  << " Polling round took " << elapsed.count()
+                  << "us, longer than the polling interval, max "
+                  << maxPollRoundLatency.count() << "us" << std::endl;
     }
-
-    return;
 }
 
 bool verifySensorFunctionalStatus(const uint8_t& pdrType,
@@ -1801,30 +2072,29 @@ bool verifySensorAvailableStatus(const uint8_t& pdrType,
 /** @brief Callback function to process the response data after send the
  * getSensorReading request thru PLDM
  */
-void TerminusHandler::processSensorReading(mctp_eid_t, const pldm_msg* response,
+void TerminusHandler::processSensorReading(sensor_key key, mctp_eid_t,
+                                           const pldm_msg* response,
                                            size_t respMsgLen)
 {
+    auto sensorIt = _sensorObjects.find(key);
     if (response == nullptr || !respMsgLen)
     {
-        auto sid = std::get<1>(*(this->sensorKey));
+        auto sid = std::get<1>(key);
         std::cerr << "Failed to receive response for the GetSensorReading"
                   << " command of eid:sensor " << unsigned(eid) << ":"
                   << sid << std::endl;
 
-        std::unique_ptr<PldmSensor>& sensorObj =
-        _sensorObjects[*(this->sensorKey)];
-        if (sensorObj)
+        if (sensorIt != _sensorObjects.end() && sensorIt->second)
         {
-            sensorObj->updateValue(std::numeric_limits<double>::quiet_NaN());
-            sensorObj->setFunctionalStatus(false);
-            /* Go to next sensor */
-            this->sensorKey++;
+            sensorIt->second->updateValue(
+                std::numeric_limits<double>::quiet_NaN());
+            sensorIt->second->setFunctionalStatus(false);
         }
     }
     else
     {
         int rc = PLDM_ERROR;
-        uint8_t pdr_type = std::get<2>(*(this->sensorKey));
+        uint8_t pdr_type = std::get<2>(key);
         union_range_field_format presentReading;
         uint8_t cc = 0;
         uint8_t dataSize = PLDM_SENSOR_DATA_SIZE_SINT32;
@@ -1853,7 +2123,7 @@ void TerminusHandler::processSensorReading(mctp_eid_t, const pldm_msg* response,
         }
         if (rc != PLDM_SUCCESS || cc != PLDM_SUCCESS)
         {
-            auto sid = std::get<1>(*(this->sensorKey));
+            auto sid = std::get<1>(key);
             std::cerr << "Failed to decode get sensor value: "
                     << "rc=" << unsigned(rc) << ",cc=" << unsigned(cc) << " "
                     << unsigned(eid) << ":" << sid << std::endl;
@@ -1891,42 +2161,46 @@ void TerminusHandler::processSensorReading(mctp_eid_t, const pldm_msg* response,
                     break;
             }
         }
-        std::unique_ptr<PldmSensor>& sensorObj =
-            _sensorObjects[*(this->sensorKey)];
-        bool functional = verifySensorFunctionalStatus(
-            std::get<2>(*(this->sensorKey)), operationalState);
-        bool available = verifySensorAvailableStatus(
-            std::get<2>(*(this->sensorKey)), operationalState);
+        bool functional = verifySensorFunctionalStatus(pdr_type,
+                                                       operationalState);
+        bool available = verifySensorAvailableStatus(pdr_type,
+                                                     operationalState);
         /* the CompactNumericSensor is unavailable */
         if (!available)
         {
-            unavailableSensorKeys.push_back(*(this->sensorKey));
+            unavailableSensorKeys.push_back(key);
         }
 
-        if (sensorObj)
+        if (sensorIt != _sensorObjects.end() && sensorIt->second)
         {
             /* unavailable */
             if (!functional)
             {
                 sensorValue = std::numeric_limits<double>::quiet_NaN();
             }
-            sensorObj->setFunctionalStatus(functional);
-            sensorObj->updateValue(sensorValue);
+            sensorIt->second->setFunctionalStatus(functional);
+            sensorIt->second->updateValue(sensorValue);
         }
-        this->sensorKey++;
     }
-    sendingPldmCommand = false;
+
+    if (inflightReadings)
+    {
+        inflightReadings--;
+    }
+    /* The response frees a slot of the polling window */
+    readSensor();
 
     return;
 }
 
 /** @brief Send the getSensorReading request to get sensor info
  */
-void TerminusHandler::getSensorReading(uint16_t sensor_id, uint8_t pdr_type)
+int TerminusHandler::getSensorReading(const sensor_key& key)
 {
+    auto sensor_id = std::get<1>(key);
+    auto pdr_type = std::get<2>(key);
     uint8_t req_byte = PLDM_GET_SENSOR_READING_REQ_BYTES;
 
-    sendingPldmCommand = true;
     if (pdr_type == PLDM_COMPACT_NUMERIC_SENSOR_PDR)
     {
         req_byte = PLDM_GET_SENSOR_READING_REQ_BYTES;
@@ -1958,7 +2232,7 @@ void TerminusHandler::getSensorReading(uint16_t sensor_id, uint8_t pdr_type)
         instanceIdDb.free(eid, instanceId);
         std::cerr << "Failed to reading sensor/effecter, rc = " << rc
                   << std::endl;
-        return;
+        return rc;
     }
 
     uint8_t cmd = PLDM_GET_SENSOR_READING;
@@ -1972,33 +2246,149 @@ void TerminusHandler::getSensorReading(uint16_t sensor_id, uint8_t pdr_type)
     }
 
     rc = handler->registerRequest(
-        eid, instanceId, PLDM_PLATFORM, cmd,
-        std::move(requestMsg),
-        std::move(std::bind_front(&TerminusHandler::processSensorReading,
-            this)));
+        eid, instanceId, PLDM_PLATFORM, cmd, std::move(requestMsg),
+        std::move(std::bind_front(&TerminusHandler::processSensorReading, this,
+                                  key)));
     if (rc)
     {
         std::cerr << "Failed to send reading sensor/effecter request to Host"
                   << std::endl;
     }
 
-    return;
+    return rc;
 }
 
 void TerminusHandler::updateSensorKeys()
 {
-    sensorKeys.clear();
-    for(auto it = _state.begin(); it != _state.end(); ++it) {
-        sensorKeys.push_back(it->first);
+    for (const auto& key : pollScheduler.keys())
+    {
+        if (!_state.contains(key))
+        {
+            pollScheduler.remove(key);
+        }
+    }
+
+    for (const auto& [key, value] : _state)
+    {
+        if (pollScheduler.contains(key))
+        {
+            continue;
+        }
+        uint32_t period = 1;
+        if (sensorPollPeriods.contains(key))
+        {
+            period = sensorPollPeriods[key];
+        }
+        pollScheduler.add(key, period);
     }
 }
 
+pldm::dbus_api::DebugStats::Counters TerminusHandler::getPollingCounters() const
+{
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - pollingStart);
+    uint64_t savedPerSec = 0;
+    if (continuePollSensor && elapsed.count() > 0)
+    {
+        savedPerSec = pollScheduler.getSkippedReads() * 1000 / elapsed.count();
+    }
+
+    pldm::dbus_api::DebugStats::Counters counters{
+        {"PollingRounds", static_cast<uint64_t>(readCount)},
+        {"PolledSensors", pollScheduler.size()},
+        {"PollingWindow", pollingWindow},
+        {"EventDrivenSensors", pollScheduler.getEventDriven()},
+        {"SensorEvents", sensorEvents},
+        {"SensorReads", pollScheduler.getDueReads()},
+        {"SensorReadsSaved", pollScheduler.getSkippedReads()},
+        {"SensorReadsSavedPerSec", savedPerSec},
+        {"LastRoundLatencyUs",
+         static_cast<uint64_t>(lastPollRoundLatency.count())},
+        {"MaxRoundLatencyUs",
+         static_cast<uint64_t>(maxPollRoundLatency.count())}};
+    for (const auto& [stage, elapsed] : discoveryStageTimes)
+    {
+        counters.emplace("Discovery" + stage + "Us",
+                         static_cast<uint64_t>(elapsed.count()));
+    }
+    return counters;
+}
+
+void TerminusHandler::setUUID(const std::string& uuid)
+{
+    /* The UUID names the cache file */
+    auto isUUIDChar = [](unsigned char c) {
+        return std::isxdigit(c) || c == '-';
+    };
+    if (uuid.empty() || !std::all_of(uuid.begin(), uuid.end(), isUUIDChar))
+    {
+        pdrCache.reset();
+        return;
+    }
+    pdrCache.emplace(std::filesystem::path(TERMINUS_PDR_CACHE_DIR) /
+                     ("terminus_" + uuid));
+}
+
 void TerminusHandler::stopTerminusHandler()
 {
     stopTerminusPolling = true;
     continuePollSensor = false;
 }
 
+bool TerminusHandler::invalidatePDRCache(uint8_t tid)
+{
+    if (tid != devInfo.tid)
+    {
+        return false;
+    }
+
+    std::cerr << "PDR repository of EID=" << unsigned(eid)
+              << " changed, drop the cached PDRs." << std::endl;
+    if (pdrCache)
+    {
+        pdrCache->invalidate();
+    }
+    /* Don't cache PDRs being fetched with the stale repository info */
+    pdrRepoInfo.reset();
+    return true;
+}
+
+bool TerminusHandler::updateSensorFromEvent(uint16_t sensorId,
+                                            uint8_t sensorDataSize,
+                                            uint32_t presentReading)
+{
+    auto key = std::make_tuple(eid, sensorId,
+                               uint8_t(PLDM_COMPACT_NUMERIC_SENSOR_PDR));
+    auto sensorIt = _sensorObjects.find(key);
+    if (sensorIt == _sensorObjects.end() || !sensorIt->second)
+    {
+        return false;
+    }
+
+    auto sensorValue = decodeEventReading(sensorDataSize, presentReading);
+    if (!sensorValue)
+    {
+        std::cerr << "Invalid data size " << unsigned(sensorDataSize)
+                  << " in the sensor event of eid:sensor " << unsigned(eid)
+                  << ":" << sensorId << std::endl;
+        return true;
+    }
+    sensorIt->second->setFunctionalStatus(true);
+    sensorIt->second->updateValue(*sensorValue);
+    sensorEvents++;
+
+    auto livenessPeriod = livenessPeriodTicks(
+        std::chrono::seconds(SENSOR_EVENT_LIVENESS_INTERVAL),
+        std::chrono::milliseconds(POLL_SENSOR_TIMER_INTERVAL));
+    if (livenessPeriod)
+    {
+        /* Only read the sensor when it stops pushing its value, the liveness
+         * read puts it back on its PDR polling period */
+        pollScheduler.postpone(key, livenessPeriod);
+    }
+    return true;
+}
+
 void TerminusHandler::addEventMsg(uint8_t tid, uint8_t eventId,
                                   uint8_t eventType, uint8_t eventClass)
 {
@@ -4,9 +4,12 @@
 
 #include "common/instance_id.hpp"
 #include "common/types.hpp"
+#include "pldmd/dbus_impl_debug.hpp"
 #include "pldmd/dbus_impl_fru.hpp"
 #include "requester/handler.hpp"
+#include "requester/pdr_cache.hpp"
 #include "requester/pldm_message_poll_event.hpp"
+#include "requester/sensor_poll_scheduler.hpp"
 #include "sensors/pldm_sensor.hpp"
 
 #include <sdeventplus/event.hpp>
@@ -14,7 +17,9 @@
 #include <sdeventplus/utility/timer.hpp>
 
 #include <unistd.h>
+#include <functional>
 #include <map>
+#include <optional>
 
 namespace pldm
 {
@@ -52,7 +57,7 @@ struct PLDMSupportedCommands
 struct PldmDeviceInfo
 {
     uint8_t eid;
-    uint8_t tid;
+    uint8_t tid = PLDM_TID_RESERVED;
     BitField8 supportedTypes[8];
     PLDMSupportedCommands supportedCmds[PLDM_MAX_TYPES];
 };
@@ -147,6 +152,26 @@ class TerminusHandler
         return true;
     }
 
+    /** @brief Set the UUID of the terminus, its PDRs are only cached across
+     *  restarts under a UUID as the EID can be assigned to another terminus
+     *
+     *  @param[in] uuid - UUID of the MCTP endpoint of the terminus
+     */
+    void setUUID(const std::string& uuid);
+
+    /** @brief Set the callback called when GetTID changes the TID of the
+     *  terminus
+     *
+     *  @param[in] handler - callback taking the previous and the new TID
+     *
+     *  @return - none
+     *
+     */
+    void setTidChangeHandler(std::function<void(uint8_t, uint8_t)> handler)
+    {
+        tidChangeHandler = std::move(handler);
+    }
+
     /** @brief Discovery new terminus
      *
      * @return - none
@@ -193,6 +218,32 @@ class TerminusHandler
     void addEventMsg(uint8_t tid, uint8_t eventId, uint8_t eventType,
                      uint8_t eventClass);
 
+    /** @brief Drop the cached PDRs of the terminus when its PDR repository
+     *  changed
+     *
+     *  @param[in] tid - Terminus ID which sent the PDR repository change event
+     *
+     *  @return - true if the event is for this terminus
+     *
+     */
+    bool invalidatePDRCache(uint8_t tid);
+
+    /** @brief Update a numeric sensor from a sensor event of the terminus
+     *
+     *  @details Every sensor event postpones the next reading of the sensor
+     *  by sensor-event-liveness-interval seconds. When the events stop, the
+     *  sensor is read and goes back to its polling period.
+     *
+     *  @param[in] sensorId - Sensor ID of the event
+     *  @param[in] sensorDataSize - size of the present reading
+     *  @param[in] presentReading - present reading of the sensor
+     *
+     *  @return - true if the terminus has the sensor
+     *
+     */
+    bool updateSensorFromEvent(uint16_t sensorId, uint8_t sensorDataSize,
+                               uint32_t presentReading);
+
     /** @brief Get TID of this terminus handler
      *
      *  @param - none
@@ -228,11 +279,26 @@ class TerminusHandler
      */
     requester::Coroutine getTID();
 
+    /** @brief Set the TID of the terminus and report the change
+     *
+     *  @param[in] tid - TID from GetTID, PLDM_TID_RESERVED when unknown
+     */
+    void setTid(uint8_t tid);
+
     /** @brief Get supported PLDM commands of the terminus for every supported
      *  PLDM type
      */
     requester::Coroutine getPLDMCommands();
-    requester::Coroutine getPLDMCommand(const uint8_t& pldmTypeIdx);
+    requester::Coroutine getPLDMCommand(uint8_t pldmTypeIdx);
+
+    /** @brief Start a discovery stage, await it and record how long it took
+     *  @param[in] stage - name of the stage in the timing breakdown
+     *  @param[in] discoveryStage - the stage to start
+     */
+    requester::Coroutine
+        timeDiscoveryStage(std::string stage,
+                           requester::Coroutine (TerminusHandler::*
+                                                     discoveryStage)());
 
     /** @brief whether terminus support PLDM command type
      */
@@ -259,6 +325,11 @@ class TerminusHandler
      */
     requester::Coroutine getFRURecordTable(const uint16_t& total);
 
+    /** @brief Get the FRU Record Table Metadata then the FRU Record Table
+     *  from remote MCTP Endpoint
+     */
+    requester::Coroutine getFRU();
+
     /** @brief Get FRU Record Table Metadata from remote MCTP Endpoint
      */
     requester::Coroutine getFRURecordTableMetadata(uint16_t* total);
@@ -269,6 +340,17 @@ class TerminusHandler
      */
     void parseFruRecordTable(const uint8_t* fruData, size_t& fruLen);
 
+    /** @brief Get the PDRs of the terminus from the PDR cache when the PDR
+     *  repository is unchanged, from the terminus otherwise
+     */
+    requester::Coroutine getPDRs();
+
+    /** @brief Get the PDR repository signature of the terminus
+     *  @param[out] info - update times, record count and sizes of the PDR
+     *                     repository
+     */
+    requester::Coroutine getPDRRepositoryInfo(PDRRepositoryInfo* info);
+
     /** @brief this function sends a GetPDR request to Host firmware.
      *  And processes the PDRs based on type
      *
@@ -302,6 +384,12 @@ class TerminusHandler
                                         uint32_t* nextRecordHandle,
                                         uint32_t recordHandle);
 
+    /** @brief Sort a PDR of the terminus by type and add it to BMC's PDR repo
+     *  @param[in] rh - record handle of the PDR
+     *  @param[in] pdr - PDR fetched from the terminus or from the cache
+     */
+    void processPDR(uint32_t rh, const std::vector<uint8_t>& pdr);
+
     /** @brief Parse comback numeric sensor PDRs and create the sensor D-Bus
      *  objects
      *
@@ -335,7 +423,8 @@ class TerminusHandler
      */
     void pollSensors();
 
-    /** @brief Start reading the sensors info process
+    /** @brief Send the sensor readings of the polling round until the
+     *  polling window is full
      *
      *  @param - none
      *
@@ -344,26 +433,35 @@ class TerminusHandler
      */
     void readSensor();
 
-    /** @brief Send the getSensorReading request to get sensor info
+    /** @brief Complete the polling round and record its latency
      *
-     *  @param[in] sensor_id - Sensor ID
-     *  @param[in] pdr_type - PDR type
+     *  @param - none
      *
      *  @return - none
      *
      */
-    void getSensorReading(uint16_t sensor_id, uint8_t pdr_type);
+    void finishPollRound();
+
+    /** @brief Send the getSensorReading request to get sensor info
+     *
+     *  @param[in] key - sensor key of the sensor or effecter
+     *
+     *  @return - PLDM_SUCCESS when the request is registered
+     *
+     */
+    int getSensorReading(const sensor_key& key);
 
     /** @brief Process response data from the getSensorReading request
      *
+     *  @param[in] key - sensor key the request was sent for
      *  @param[in] response - response message
      *  @param[in] respMsgLen - response message length
      *
      *  @return - none
      *
      */
-    void processSensorReading(mctp_eid_t, const pldm_msg* response,
-                              size_t respMsgLen);
+    void processSensorReading(sensor_key key, mctp_eid_t,
+                              const pldm_msg* response, size_t respMsgLen);
 
     /** @brief Remove the sensor which response OperationState as not enabled
      *  in GetSensorReading command
@@ -388,7 +486,7 @@ class TerminusHandler
      */
     void removeEffecterFromPollingList(const std::vector<sensor_key>& vKeys);
 
-    /** @brief Create/Update list of sensor keys which will be polling
+    /** @brief Sync the polling schedule with the list of polled sensors
      *
      *  @param[in] none
      *
@@ -397,6 +495,16 @@ class TerminusHandler
      */
     void updateSensorKeys();
 
+    /** @brief Collect the sensor polling and discovery counters for the debug
+     *  D-Bus object
+     *
+     *  @param[in] none
+     *
+     *  @return - counter names and values
+     *
+     */
+    pldm::dbus_api::DebugStats::Counters getPollingCounters() const;
+
     /** @brief map that captures various terminus information **/
     TLPDRMap tlPDRInfo;
 
@@ -424,6 +532,21 @@ class TerminusHandler
     /** @brief Instance ID database for managing instance ID*/
     InstanceIdDb& instanceIdDb;
 
+    /** @brief PDRs of the terminus kept across restarts, unset when the
+     *  terminus has no UUID
+     */
+    std::optional<PDRCache> pdrCache;
+
+    /** @brief PDR repository signature the PDRs are fetched with, reset when
+     *  the terminus reports a repository change
+     */
+    std::optional<PDRRepositoryInfo> pdrRepoInfo;
+
+    /** @brief PDRs fetched by getDevPDR, stored into the cache once all of
+     *  them are received
+     */
+    PDRCache::Records fetchedPDRs;
+
     /** @brief whether response received from Host */
     bool responseReceived;
 
@@ -472,34 +595,62 @@ class TerminusHandler
     std::vector<sensor_key> _effecterLists;
     /** @brief Identify the D-Bus interface for the sensors is created */
     bool createdDbusObject = false;
-    /* The point to the reading sensors */
-    std::vector<sensor_key>::iterator sensorKey;
+    /* Index of the next sensor to read in the polling round */
+    size_t nextSensorIdx = 0;
+    /* Sensors due in the polling round */
     std::vector<sensor_key> sensorKeys;
+    /** @brief Polling period in rounds of each sensor from its PDR rate */
+    std::map<sensor_key, uint32_t> sensorPollPeriods;
+    /** @brief Timing wheel of the polled sensors keyed on next-due round */
+    SensorPollScheduler<sensor_key> pollScheduler;
+    /** @brief Number of sensor events which updated a sensor */
+    uint64_t sensorEvents = 0;
     std::vector<sensor_key> unavailableSensorKeys;
     /** @brief Poll sensor timer. Reset after each poll-sensor-timer-interval
      *  milliseconds. poll-sensor-timer-interval is package configuration.
      */
     sdeventplus::utility::Timer<sdeventplus::ClockId::Monotonic> _timer;
 
-    /** @brief Sleep timer between PLDM GetSensorReading commands.
-     *  @details Because the performance and the responding time for
-     *  GetSensorReading of terminus can be different. The sleep interval
-     *  between GetSensorReading commands will be added. This value can be
-     *  configured thru sleep-between-get-sensor-reading option. The option is
-     *  milliseconds. The default value is 10 milliseconds
+    /** @brief Maximum number of sensor readings in flight, the
+     *  sensor-polling-window clamped to the in-flight window of the request
+     *  handler which would queue the readings beyond it
+     */
+    const size_t pollingWindow;
+
+    /** @brief Number of GetSensorReading requests waiting for a response.
+     *  @details At most pollingWindow readings are in flight, the next one is
+     *  sent when a response or its timeout frees a slot.
      */
-    sdeventplus::utility::Timer<sdeventplus::ClockId::Monotonic> _timer2;
+    size_t inflightReadings = 0;
+
+    /** @brief Duration of each stage of the last discovery, FirstSensor and
+     *  Total are measured from the start of the discovery
+     */
+    std::map<std::string, std::chrono::microseconds> discoveryStageTimes;
+
+    /** @brief The start time of the current polling round */
+    std::chrono::steady_clock::time_point pollRoundStart{};
+    /** @brief Latency of the last completed polling round */
+    std::chrono::microseconds lastPollRoundLatency{0};
+    /** @brief Highest latency of a polling round */
+    std::chrono::microseconds maxPollRoundLatency{0};
+    /** @brief The time the sensor polling was started */
+    std::chrono::steady_clock::time_point pollingStart{};
+    /** @brief Sensor polling counters on the debug D-Bus object */
+    std::unique_ptr<pldm::dbus_api::DebugStats> pollingStats;
 
     /** @brief Polling sensor flag. True when pldmd is polling sensor values */
     bool pollingSensors = false;
     /** @brief Enable the measurement in polling sensors */
     bool debugPollSensor = true;
-    /** @brief whether response received for getsensorreading pldm command  */
-    bool sendingPldmCommand = false;
     bool continuePollSensor = false;
     std::shared_ptr<PldmMessagePollEvent> eventDataHndl;
     /** @brief the flag to stop polling or discoverying */
     bool stopTerminusPolling = false;
+    /** @brief Called with the previous and the new TID when GetTID changes
+     *  the TID
+     */
+    std::function<void(uint8_t, uint8_t)> tidChangeHandler;
 };
 
 } // namespace terminus
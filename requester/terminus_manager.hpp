@@ -5,6 +5,7 @@
 #include "requester/handler.hpp"
 #include "requester/request.hpp"
 #include "requester/terminus_handler.hpp"
+#include "requester/tid_index.hpp"
 
 #include <nlohmann/json.hpp>
 #include <sdeventplus/event.hpp>
@@ -64,10 +65,12 @@ class Manager
     /** @brief Add the discovered MCTP endpoints to the managed devices list
      *
      *  @param[in] eids - Array of MCTP endpoints
+     *  @param[in] uuids - UUID of the MCTP endpoints which report one
      *
      *  @return None
      */
-    void addDevices(const std::vector<mctp_eid_t>& eids)
+    void addDevices(const std::vector<mctp_eid_t>& eids,
+                    const std::map<mctp_eid_t, std::string>& uuids = {})
     {
         for (const auto& it : eids)
         {
@@ -82,6 +85,18 @@ class Manager
                 eidMap = eidToNameMaps[it];
             }
             dev->udpateEidMapping(eidMap);
+            if (uuids.contains(it))
+            {
+                dev->setUUID(uuids.at(it));
+            }
+            dev->setTidChangeHandler(
+                [this, ptr = dev.get()](uint8_t oldTid, uint8_t newTid) {
+                tidIndex.move(ptr, oldTid, newTid);
+            });
+            if (mDevices.contains(it))
+            {
+                tidIndex.remove(mDevices[it]->getTid(), mDevices[it].get());
+            }
             [[maybe_unused]] auto co = dev->discoveryTerminus();
             dev->startSensorsPolling();
             mDevices[it] = std::move(dev);
@@ -106,6 +121,7 @@ class Manager
             }
             std::unique_ptr<TerminusHandler>& dev = mDevices[it];
             dev->stopTerminusHandler();
+            tidIndex.remove(dev->getTid(), dev.get());
             mDevices.erase(it);
         }
         return;
@@ -114,13 +130,51 @@ class Manager
     void addEventMsg(uint8_t tid, uint8_t eventId, uint8_t eventType,
                      uint8_t eventClass)
     {
-        for (auto it = mDevices.begin(); it != mDevices.end(); ++it)
+        for (auto dev : tidIndex.find(tid))
         {
-            auto secondPtr = it->second.get();
-            secondPtr->addEventMsg(tid, eventId, eventType, eventClass);
+            dev->addEventMsg(tid, eventId, eventType, eventClass);
         }
     }
 
+    /** @brief Drop the cached PDRs of the terminus which reported a PDR
+     *  repository change
+     *
+     *  @param[in] tid - Terminus ID
+     *
+     *  @return true if a managed terminus has the TID
+     */
+    bool invalidatePDRCache(uint8_t tid)
+    {
+        bool found = false;
+        for (auto dev : tidIndex.find(tid))
+        {
+            found |= dev->invalidatePDRCache(tid);
+        }
+        return found;
+    }
+
+    /** @brief Update a numeric sensor of the terminus which sent a sensor
+     *  event
+     *
+     *  @param[in] tid - Terminus ID
+     *  @param[in] sensorId - Sensor ID
+     *  @param[in] sensorDataSize - size of the present reading
+     *  @param[in] presentReading - present reading of the sensor
+     *
+     *  @return true if a managed terminus has the sensor
+     */
+    bool updateSensorFromEvent(uint8_t tid, uint16_t sensorId,
+                               uint8_t sensorDataSize, uint32_t presentReading)
+    {
+        bool found = false;
+        for (auto dev : tidIndex.find(tid))
+        {
+            found |= dev->updateSensorFromEvent(sensorId, sensorDataSize,
+                                                presentReading);
+        }
+        return found;
+    }
+
   private:
     /** @brief reference of main D-bus interface of pldmd devices */
     sdbusplus::bus::bus& bus;
@@ -147,6 +201,9 @@ class Manager
 
     std::map<mctp_eid_t, std::unique_ptr<TerminusHandler>> mDevices;
 
+    /** @brief Termini of each TID known from GetTID */
+    TidIndex<TerminusHandler> tidIndex;
+
     /*
      * Mapping from "TIDx" in sensor name to prefix/subfix "ABCD"
      */
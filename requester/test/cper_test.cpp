@@ -0,0 +1,262 @@
+#include "requester/cper.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern Guid CPER_SEC_PROC_ARM;
+extern Guid CPER_SEC_PLATFORM_MEM;
+extern Guid CPER_SEC_PCIE;
+extern Guid CPER_AMPERE_SPECIFIC;
+
+namespace
+{
+
+template <typename T>
+void appendStruct(std::vector<uint8_t>& data, const T& value)
+{
+    auto size = data.size();
+    data.resize(size + sizeof(T));
+    std::memcpy(data.data() + size, &value, sizeof(T));
+}
+
+/** @brief Build a CPER record from the type and body of its sections */
+std::vector<uint8_t>
+    buildRecord(const std::vector<std::pair<Guid, std::vector<uint8_t>>>&
+                    sections)
+{
+    CPERRecodHeader header{};
+    header.SignatureStart = 0x43504552; // "CPER" reversed
+    header.SectionCount = sections.size();
+
+    size_t offset = sizeof(CPERRecodHeader) +
+                    sections.size() * sizeof(CPERSectionDescriptor);
+    std::vector<uint8_t> descriptors;
+    std::vector<uint8_t> bodies;
+    for (const auto& [type, body] : sections)
+    {
+        CPERSectionDescriptor desc{};
+        desc.SectionOffset = offset + bodies.size();
+        desc.SectionLength = body.size();
+        desc.SectionType = type;
+        appendStruct(descriptors, desc);
+        bodies.insert(bodies.end(), body.begin(), body.end());
+    }
+    header.RecordLength = offset + bodies.size();
+
+    std::vector<uint8_t> record;
+    appendStruct(record, header);
+    record.insert(record.end(), descriptors.begin(), descriptors.end());
+    record.insert(record.end(), bodies.begin(), bodies.end());
+    return record;
+}
+
+std::vector<uint8_t> ampereSection(uint16_t type, uint16_t subType)
+{
+    AmpereSpecData spec{};
+    spec.typeId.type = type;
+    spec.subTypeId = subType;
+    std::vector<uint8_t> body;
+    appendStruct(body, spec);
+    body.resize(body.size() + 24, 0xa5);
+    return body;
+}
+
+std::vector<uint8_t> armSection(uint16_t errInfoNum, uint16_t ctxType)
+{
+    CPERSecProcArm proc{};
+    proc.ErrInfoNum = errInfoNum;
+    proc.ContextInfoNum = 1;
+    CPERArmCtxInfo ctx{};
+    ctx.RegisterContextType = ctxType;
+    ctx.RegisterArraySize = sizeof(ARM_V8_AARCH64_GPR);
+    AmpereSpecData spec{};
+    spec.typeId.type = 0x42;
+
+    proc.SectionLength = sizeof(proc) + errInfoNum * sizeof(CPERArmErrInfo) +
+                         sizeof(ctx) + ctx.RegisterArraySize + sizeof(spec);
+    std::vector<uint8_t> body;
+    appendStruct(body, proc);
+    body.resize(body.size() + errInfoNum * sizeof(CPERArmErrInfo), 0x11);
+    appendStruct(body, ctx);
+    body.resize(body.size() + ctx.RegisterArraySize, 0x22);
+    appendStruct(body, spec);
+    return body;
+}
+
+std::vector<uint8_t> memorySection(uint8_t errorType)
+{
+    CPERSecMemErr mem{};
+    mem.ErrorType = errorType;
+    std::vector<uint8_t> body;
+    appendStruct(body, mem);
+    return body;
+}
+
+std::vector<uint8_t> pcieSection(uint32_t portType)
+{
+    CPERSecPcieErr pcie{};
+    pcie.ValidFields = CPER_PCIE_VALID_PORT_TYPE;
+    pcie.PortType = portType;
+    std::vector<uint8_t> body;
+    appendStruct(body, pcie);
+    return body;
+}
+
+} // namespace
+
+TEST(CperDecode, sections)
+{
+    auto ampere = ampereSection(0x1234, 0x5678);
+    auto arm = armSection(2, ARM_CONTEXT_TYPE_AARCH64_GPR);
+    auto pcie = pcieSection(CPER_PCIE_PORT_TYPE_ROOT_PORT);
+    auto record = buildRecord({{CPER_AMPERE_SPECIFIC, ampere},
+                               {CPER_SEC_PROC_ARM, arm},
+                               {CPER_SEC_PCIE, pcie}});
+
+    AmpereSpecData spec{};
+    std::vector<uint8_t> out;
+    ASSERT_EQ(decodeCperRecord(record, &spec, out), 0);
+
+    /* Every section is emitted as is, only the signature is reversed */
+    ASSERT_EQ(out.size(), record.size());
+    EXPECT_EQ(std::string(out.begin(), out.begin() + 4), "CPER");
+    EXPECT_TRUE(std::equal(out.begin() + 4, out.end(), record.begin() + 4));
+
+    /* The ARM section overrides the Ampere header, PCIe sets the subtype */
+    EXPECT_EQ(spec.typeId.type, 0x42);
+    EXPECT_EQ(spec.subTypeId, ERROR_SUBTYPE_PCIE_AER_ROOT_PORT);
+}
+
+TEST(CperDecode, memoryParity)
+{
+    auto record =
+        buildRecord({{CPER_SEC_PLATFORM_MEM,
+                      memorySection(MEM_ERROR_TYPE_PARITY)}});
+
+    AmpereSpecData spec{};
+    std::vector<uint8_t> out;
+    ASSERT_EQ(decodeCperRecord(record, &spec, out), 0);
+    EXPECT_EQ(out.size(), record.size());
+    EXPECT_EQ(spec.typeId.member.ipType, ERROR_TYPE_ID_MCU);
+    EXPECT_EQ(spec.subTypeId, SUBTYPE_ID_PARITY);
+}
+
+TEST(CperDecode, invalidRecordLength)
+{
+    auto record = buildRecord({{CPER_SEC_PCIE, pcieSection(0)}});
+    AmpereSpecData spec{};
+    std::vector<uint8_t> out;
+
+    /* Longer than the data received */
+    auto truncated = record;
+    truncated.pop_back();
+    EXPECT_EQ(decodeCperRecord(truncated, &spec, out), -1);
+
+    /* Shorter than the section descriptors */
+    auto header = reinterpret_cast<CPERRecodHeader*>(record.data());
+    header->RecordLength = sizeof(CPERRecodHeader);
+    EXPECT_EQ(decodeCperRecord(record, &spec, out), -1);
+
+    EXPECT_EQ(decodeCperRecord(std::span(record).first(10), &spec, out), -1);
+}
+
+TEST(CperDecode, skipInvalidSections)
+{
+    Guid unknown{1, 2, 3, {4, 5, 6, 7, 8, 9, 10, 11}};
+    auto pcie = pcieSection(0);
+    auto record = buildRecord({{unknown, memorySection(0)},
+                               {CPER_SEC_PLATFORM_MEM, {1, 2, 3}},
+                               {CPER_SEC_PCIE, pcie}});
+
+    AmpereSpecData spec{};
+    std::vector<uint8_t> out;
+    ASSERT_EQ(decodeCperRecord(record, &spec, out), 0);
+    EXPECT_EQ(out.size(), sizeof(CPERRecodHeader) +
+                              3 * sizeof(CPERSectionDescriptor) +
+                              pcie.size());
+    EXPECT_EQ(spec.subTypeId, ERROR_SUBTYPE_PCIE_AER_DEVICE);
+}
+
+TEST(CperDecode, fuzz)
+{
+    auto valid = buildRecord(
+        {{CPER_AMPERE_SPECIFIC, ampereSection(1, 2)},
+         {CPER_SEC_PROC_ARM, armSection(1, ARM_CONTEXT_TYPE_MISC)},
+         {CPER_SEC_PLATFORM_MEM, memorySection(MEM_ERROR_TYPE_PARITY)},
+         {CPER_SEC_PCIE, pcieSection(0)}});
+
+    std::mt19937 rng(20240501);
+    std::uniform_int_distribution<size_t> byte(0, 255);
+    AmpereSpecData spec{};
+    std::vector<uint8_t> out;
+
+    for (int i = 0; i < 20000; i++)
+    {
+        /* Corrupt a few bytes of a valid record, or cut it short */
+        auto record = valid;
+        auto flips = 1 + rng() % 8;
+        for (size_t f = 0; f < flips; f++)
+        {
+            record[rng() % record.size()] = byte(rng);
+        }
+        if (rng() % 4 == 0)
+        {
+            record.resize(rng() % record.size());
+        }
+
+        auto rc = decodeCperRecord(record, &spec, out);
+        if (rc == 0)
+        {
+            auto header = reinterpret_cast<CPERRecodHeader*>(record.data());
+            EXPECT_LE(header->RecordLength, record.size());
+        }
+    }
+
+    /* Random bytes */
+    for (int i = 0; i < 5000; i++)
+    {
+        std::vector<uint8_t> record(rng() % 1024);
+        for (auto& b : record)
+        {
+            b = byte(rng);
+        }
+        decodeCperRecord(record, &spec, out);
+    }
+}
+
+TEST(CperDecodeThroughput, multiSectionRecords)
+{
+    std::vector<std::pair<Guid, std::vector<uint8_t>>> sections;
+    for (int i = 0; i < 4; i++)
+    {
+        sections.emplace_back(CPER_AMPERE_SPECIFIC, ampereSection(i, i));
+        sections.emplace_back(CPER_SEC_PROC_ARM,
+                              armSection(4, ARM_CONTEXT_TYPE_AARCH64_GPR));
+        sections.emplace_back(CPER_SEC_PLATFORM_MEM, memorySection(0));
+        sections.emplace_back(CPER_SEC_PCIE, pcieSection(0));
+    }
+    auto record = buildRecord(sections);
+
+    constexpr int records = 20000;
+    AmpereSpecData spec{};
+    std::vector<uint8_t> out;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < records; i++)
+    {
+        ASSERT_EQ(decodeCperRecord(record, &spec, out), 0);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+    EXPECT_EQ(out.size(), record.size());
+
+    auto mbPerSec = elapsed.count()
+                        ? record.size() * records / elapsed.count()
+                        : 0;
+    RecordProperty("sections_per_record", std::to_string(sections.size()));
+    RecordProperty("mb_per_sec", std::to_string(mbPerSec));
+}
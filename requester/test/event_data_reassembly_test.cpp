@@ -0,0 +1,106 @@
+#include "requester/event_data_reassembly.hpp"
+
+#include <libpldm/utils.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm;
+
+namespace
+{
+
+std::vector<uint8_t> eventData(size_t size)
+{
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        data[i] = static_cast<uint8_t>(i * 13 + i / 256);
+    }
+    return data;
+}
+
+} // namespace
+
+TEST(EventDataReassembly, inOrderParts)
+{
+    auto data = eventData(1000);
+    EventDataReassembly reassembly;
+    reassembly.reset(data.size());
+
+    std::span<const uint8_t> all(data);
+    for (uint32_t offset = 0; offset < data.size(); offset += 300)
+    {
+        auto count = std::min<size_t>(300, data.size() - offset);
+        EXPECT_TRUE(reassembly.append(offset, all.subspan(offset, count)));
+    }
+
+    EXPECT_EQ(reassembly.data(), data);
+    EXPECT_EQ(reassembly.checksum(), crc32(data.data(), data.size()));
+}
+
+TEST(EventDataReassembly, repeatedPart)
+{
+    auto data = eventData(600);
+    std::span<const uint8_t> all(data);
+    EventDataReassembly reassembly;
+    reassembly.reset();
+
+    EXPECT_TRUE(reassembly.append(0, all.first(200)));
+    EXPECT_TRUE(reassembly.append(200, all.subspan(200, 200)));
+    /* The terminus sends the second part again */
+    EXPECT_TRUE(reassembly.append(200, all.subspan(200, 200)));
+    EXPECT_TRUE(reassembly.append(400, all.subspan(400)));
+
+    EXPECT_EQ(reassembly.data(), data);
+    EXPECT_EQ(reassembly.checksum(), crc32(data.data(), data.size()));
+}
+
+TEST(EventDataReassembly, gap)
+{
+    auto data = eventData(600);
+    std::span<const uint8_t> all(data);
+    EventDataReassembly reassembly;
+    reassembly.reset();
+
+    EXPECT_TRUE(reassembly.append(0, all.first(200)));
+    EXPECT_FALSE(reassembly.append(400, all.subspan(400)));
+    EXPECT_EQ(reassembly.size(), 200);
+
+    reassembly.reset();
+    EXPECT_EQ(reassembly.size(), 0);
+    EXPECT_EQ(reassembly.checksum(), crc32(data.data(), 0));
+}
+
+TEST(EventDataReassembly, reassemble64KiB)
+{
+    constexpr size_t iterations = 100;
+    constexpr size_t partSize = 1024;
+    auto data = eventData(64 * 1024);
+    std::span<const uint8_t> all(data);
+    EventDataReassembly reassembly;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++)
+    {
+        reassembly.reset(data.size());
+        for (uint32_t offset = 0; offset < data.size(); offset += partSize)
+        {
+            ASSERT_TRUE(
+                reassembly.append(offset, all.subspan(offset, partSize)));
+        }
+        ASSERT_EQ(reassembly.checksum(), crc32(data.data(), data.size()));
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    EXPECT_EQ(reassembly.data(), data);
+    /* Includes the one shot checksum the result is compared with */
+    auto perRecord = elapsed.count() / iterations;
+    RecordProperty("us_per_64KiB_record", std::to_string(perRecord));
+    EXPECT_LT(perRecord, 100000);
+}
@@ -0,0 +1,37 @@
+#include "common/instance_id.hpp"
+#include "requester/event_hander_interface.hpp"
+#include "requester/handler.hpp"
+#include "test/test_instance_id.hpp"
+
+#include <sdbusplus/bus.hpp>
+#include <sdeventplus/event.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace pldm;
+using namespace std::chrono;
+
+TEST(EventHandlerInterface, criticalEventsDispatchedWithoutTimers)
+{
+    auto event = sdeventplus::Event::get_default();
+    auto bus = sdbusplus::bus::new_default();
+    TestInstanceIdDb instanceIdDb;
+    // Without a transport every poll fails and gets an empty response
+    requester::Handler<requester::Request> handler(
+        nullptr, event, instanceIdDb, false, seconds(1), 2, milliseconds(100));
+    EventHandlerInterface eventHandler(1, event, bus, instanceIdDb, &handler);
+
+    for (uint16_t eventId = 1; eventId <= 16; eventId++)
+    {
+        EXPECT_EQ(eventHandler.enqueueCriticalEvent(eventId), 0);
+    }
+    EXPECT_FALSE(eventHandler.areBMCRASQueuesEmpty());
+
+    // Only dispatch the ready sources, the 25 ms poll request timer and the
+    // critical timer never expire here
+    for (int i = 0; i < 1000 && !eventHandler.areBMCRASQueuesEmpty(); i++)
+    {
+        sd_event_run(event.get(), 0);
+    }
+    EXPECT_TRUE(eventHandler.areBMCRASQueuesEmpty());
+}
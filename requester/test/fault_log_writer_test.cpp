@@ -0,0 +1,139 @@
+#include "requester/fault_log_writer.hpp"
+
+#include <sdeventplus/event.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm;
+namespace fs = std::filesystem;
+
+class FaultLogWriterTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        char tmpdir[] = "/tmp/fault_log_writer_test.XXXXXX";
+        dir = fs::path(mkdtemp(tmpdir));
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(dir);
+    }
+
+    /** @brief Run the event loop until the condition holds or 5s passed */
+    void runUntil(const std::function<bool()>& condition)
+    {
+        auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::seconds(5);
+        while (!condition() && std::chrono::steady_clock::now() < deadline)
+        {
+            event.run(std::chrono::milliseconds(10));
+        }
+    }
+
+    static std::vector<uint8_t> bytes(const std::string& content)
+    {
+        return {content.begin(), content.end()};
+    }
+
+    static std::string read(const fs::path& path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        return {std::istreambuf_iterator<char>(in),
+                std::istreambuf_iterator<char>()};
+    }
+
+    sdeventplus::Event event = sdeventplus::Event::get_new();
+    fs::path dir;
+};
+
+TEST_F(FaultLogWriterTest, writeAndComplete)
+{
+    FaultLogWriter writer(event, 4);
+    int completions = 0;
+    bool written = false;
+    ASSERT_TRUE(writer.submit({dir / "cper_1",
+                               []() { return bytes("record"); },
+                               [&](bool ok) {
+        completions++;
+        written = ok;
+    }}));
+
+    runUntil([&]() { return completions == 1; });
+    EXPECT_EQ(completions, 1);
+    EXPECT_TRUE(written);
+    EXPECT_EQ(read(dir / "cper_1"), "record");
+
+    auto counters = writer.getCounters();
+    EXPECT_EQ(counters["Submitted"], 1);
+    EXPECT_EQ(counters["Written"], 1);
+    EXPECT_EQ(counters["Failed"], 0);
+    EXPECT_EQ(counters["Dropped"], 0);
+}
+
+TEST_F(FaultLogWriterTest, writeFailure)
+{
+    FaultLogWriter writer(event, 4);
+    int completions = 0;
+    bool written = true;
+    ASSERT_TRUE(writer.submit({dir / "missing" / "cper_1",
+                               []() { return bytes("record"); }, [&](bool ok) {
+        completions++;
+        written = ok;
+    }}));
+
+    runUntil([&]() { return completions == 1; });
+    EXPECT_FALSE(written);
+    EXPECT_EQ(writer.getCounters()["Failed"], 1);
+}
+
+TEST_F(FaultLogWriterTest, dropWhenFull)
+{
+    FaultLogWriter writer(event, 2);
+    std::promise<void> started;
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    int completions = 0;
+
+    /* Hold the worker on the first record */
+    ASSERT_TRUE(writer.submit({dir / "cper_0",
+                               [&started, released]() {
+        started.set_value();
+        released.wait();
+        return bytes("record 0");
+    }, [&](bool) { completions++; }}));
+    started.get_future().wait();
+
+    for (int i = 1; i <= 2; i++)
+    {
+        EXPECT_TRUE(writer.submit(
+            {dir / ("cper_" + std::to_string(i)),
+             [i]() { return bytes("record " + std::to_string(i)); },
+             [&](bool) { completions++; }}));
+    }
+    EXPECT_FALSE(writer.submit(
+        {dir / "cper_3", []() { return bytes("record 3"); }, nullptr}));
+    EXPECT_EQ(writer.getCounters()["Queued"], 2);
+
+    release.set_value();
+    runUntil([&]() { return completions == 3; });
+    EXPECT_EQ(completions, 3);
+    EXPECT_EQ(read(dir / "cper_2"), "record 2");
+    EXPECT_FALSE(fs::exists(dir / "cper_3"));
+
+    auto counters = writer.getCounters();
+    EXPECT_EQ(counters["Submitted"], 3);
+    EXPECT_EQ(counters["Written"], 3);
+    EXPECT_EQ(counters["Dropped"], 1);
+    EXPECT_EQ(counters["MaxQueued"], 2);
+}
@@ -11,6 +11,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <functional>
+#include <utility>
+
 using namespace pldm::requester;
 using namespace std::chrono;
 
@@ -150,3 +153,214 @@ TEST_F(HandlerTest, multipleRequestResponseScenario)
     EXPECT_EQ(validResponse, true);
     EXPECT_EQ(callbackCount, 2);
 }
+
+TEST_F(HandlerTest, inflightWindowLimitsOutstandingRequests)
+{
+    Handler<NiceMock<MockRequest>> reqHandler(pldmTransport, event,
+                                              instanceIdDb, false, seconds(1),
+                                              2, milliseconds(100), 2);
+    EXPECT_EQ(reqHandler.getInflightWindow(), 2);
+
+    std::vector<uint8_t> instanceIds;
+    for (int i = 0; i < 3; i++)
+    {
+        pldm::Request request{};
+        auto instanceId = instanceIdDb.next(eid);
+        instanceIds.emplace_back(instanceId);
+        auto rc = reqHandler.registerRequest(
+            eid, instanceId, 0, 0, std::move(request),
+            std::move(
+                std::bind_front(&HandlerTest::pldmResponseCallBack, this)));
+        EXPECT_EQ(rc, PLDM_SUCCESS);
+    }
+    // The third request stays queued till a slot is released
+    EXPECT_EQ(reqHandler.getActiveRequests(eid), 2);
+
+    pldm::Response response(sizeof(pldm_msg_hdr) + sizeof(uint8_t));
+    auto responsePtr = reinterpret_cast<const pldm_msg*>(response.data());
+    // Responses are matched by RequestKey, complete the second request first
+    reqHandler.handleResponse(eid, instanceIds[1], 0, 0, responsePtr,
+                              sizeof(response));
+    EXPECT_EQ(callbackCount, 1);
+    EXPECT_EQ(reqHandler.getActiveRequests(eid), 2);
+
+    reqHandler.handleResponse(eid, instanceIds[0], 0, 0, responsePtr,
+                              sizeof(response));
+    reqHandler.handleResponse(eid, instanceIds[2], 0, 0, responsePtr,
+                              sizeof(response));
+    EXPECT_EQ(callbackCount, 3);
+    EXPECT_EQ(reqHandler.getActiveRequests(eid), 0);
+}
+
+TEST_F(HandlerTest, inflightWindowIsClamped)
+{
+    Handler<NiceMock<MockRequest>> zeroWindow(pldmTransport, event,
+                                              instanceIdDb, false, seconds(1),
+                                              2, milliseconds(100), 0);
+    EXPECT_EQ(zeroWindow.getInflightWindow(), 1);
+
+    Handler<NiceMock<MockRequest>> largeWindow(pldmTransport, event,
+                                               instanceIdDb, false, seconds(1),
+                                               2, milliseconds(100), 255);
+    EXPECT_EQ(largeWindow.getInflightWindow(), maxInflightWindow);
+}
+
+/** @class FailingRequest
+ *
+ *  Request stand-in for a PLDM transport which fails to send every request.
+ */
+class FailingRequest : public RequestRetryTimer
+{
+  public:
+    FailingRequest(PldmTransport* /*pldmTransport*/, mctp_eid_t /*eid*/,
+                   sdeventplus::Event& event, pldm::Request&& /*requestMsg*/,
+                   uint8_t numRetries,
+                   std::chrono::milliseconds responseTimeOut,
+                   bool /*verbose*/) :
+        RequestRetryTimer(event, numRetries, responseTimeOut)
+    {}
+
+  private:
+    int send() const override
+    {
+        return PLDM_ERROR;
+    }
+};
+
+TEST_F(HandlerTest, failedSendCallsResponseHandler)
+{
+    Handler<FailingRequest> reqHandler(pldmTransport, event, instanceIdDb,
+                                       false, seconds(1), 2,
+                                       milliseconds(100), 1);
+    for (int i = 0; i < 2; i++)
+    {
+        pldm::Request request{};
+        auto instanceId = instanceIdDb.next(eid);
+        auto rc = reqHandler.registerRequest(
+            eid, instanceId, 0, 0, std::move(request),
+            std::move(
+                std::bind_front(&HandlerTest::pldmResponseCallBack, this)));
+        EXPECT_EQ(rc, PLDM_SUCCESS);
+    }
+    // The response handlers are not called before registerRequest returns
+    EXPECT_EQ(callbackCount, 0);
+    EXPECT_EQ(reqHandler.getActiveRequests(eid), 0);
+
+    waitEventExpiry(milliseconds(100));
+
+    // Both requests got an empty response, the second one was not held back
+    EXPECT_EQ(nullResponse, true);
+    EXPECT_EQ(validResponse, false);
+    EXPECT_EQ(callbackCount, 2);
+}
+
+/** @class LoopbackRequest
+ *
+ *  Request stand-in for the PLDM transport, sending a request only records its
+ *  RequestKey on a simulated link so the test can answer it one round trip
+ *  later.
+ */
+class LoopbackRequest : public RequestRetryTimer
+{
+  public:
+    LoopbackRequest(PldmTransport* /*pldmTransport*/, mctp_eid_t eid,
+                    sdeventplus::Event& event, pldm::Request&& requestMsg,
+                    uint8_t numRetries,
+                    std::chrono::milliseconds responseTimeOut,
+                    bool /*verbose*/) :
+        RequestRetryTimer(event, numRetries, responseTimeOut),
+        eid(eid), requestMsg(std::move(requestMsg))
+    {}
+
+    static inline std::vector<RequestKey> link{};
+
+  private:
+    mctp_eid_t eid;
+    pldm::Request requestMsg;
+
+    int send() const override
+    {
+        auto request = reinterpret_cast<const pldm_msg*>(requestMsg.data());
+        link.emplace_back(eid, request->hdr.instance_id, request->hdr.type,
+                          request->hdr.command);
+        return PLDM_SUCCESS;
+    }
+};
+
+/** @brief Run a closed loop of requests through the handler and return the
+ *         number of simulated round trips needed to complete them
+ */
+static size_t runLoopback(Handler<LoopbackRequest>& reqHandler,
+                          TestInstanceIdDb& instanceIdDb, mctp_eid_t eid,
+                          size_t totalRequests, size_t outstanding)
+{
+    size_t registered = 0;
+    size_t completed = 0;
+    std::function<void()> registerNext = [&]() {
+        pldm::Request request(sizeof(pldm_msg_hdr));
+        auto requestPtr = reinterpret_cast<pldm_msg*>(request.data());
+        auto instanceId = instanceIdDb.next(eid);
+        encode_get_tid_req(instanceId, requestPtr);
+        registered++;
+        reqHandler.registerRequest(
+            eid, instanceId, PLDM_BASE, PLDM_GET_TID, std::move(request),
+            [&](mctp_eid_t, const pldm_msg*, size_t) {
+            completed++;
+            if (registered < totalRequests)
+            {
+                registerNext();
+            }
+        });
+    };
+
+    LoopbackRequest::link.clear();
+    for (size_t i = 0; i < outstanding && registered < totalRequests; i++)
+    {
+        registerNext();
+    }
+
+    pldm::Response response(sizeof(pldm_msg_hdr) + sizeof(uint8_t));
+    auto responsePtr = reinterpret_cast<const pldm_msg*>(response.data());
+    size_t roundTrips = 0;
+    while (completed < totalRequests && !LoopbackRequest::link.empty())
+    {
+        auto inflight = std::exchange(LoopbackRequest::link, {});
+        for (const auto& key : inflight)
+        {
+            reqHandler.handleResponse(key.eid, key.instanceId, key.type,
+                                      key.command, responsePtr,
+                                      response.size() - sizeof(pldm_msg_hdr));
+        }
+        roundTrips++;
+    }
+    EXPECT_EQ(completed, totalRequests);
+
+    return roundTrips;
+}
+
+TEST_F(HandlerTest, inflightWindowRoundTrips)
+{
+    constexpr size_t totalRequests = 512;
+    constexpr size_t outstanding = 16;
+
+    for (uint8_t window : {1, 2, 4, 8, 16})
+    {
+        Handler<LoopbackRequest> reqHandler(pldmTransport, event, instanceIdDb,
+                                            false, seconds(5), 0,
+                                            milliseconds(100), window);
+
+        auto start = steady_clock::now();
+        auto roundTrips = runLoopback(reqHandler, instanceIdDb, eid,
+                                      totalRequests, outstanding);
+        auto elapsed = duration_cast<nanoseconds>(steady_clock::now() - start);
+
+        // Latency bound link: every round trip completes one window
+        EXPECT_EQ(roundTrips, totalRequests / window);
+
+        RecordProperty("window_" + std::to_string(window) + "_round_trips",
+                       std::to_string(roundTrips));
+        RecordProperty("window_" + std::to_string(window) +
+                           "_handler_ns_per_request",
+                       std::to_string(elapsed.count() / totalRequests));
+    }
+}
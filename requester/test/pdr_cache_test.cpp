@@ -0,0 +1,114 @@
+#include "requester/pdr_cache.hpp"
+
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::terminus;
+namespace fs = std::filesystem;
+
+class PDRCacheTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        char tmpdir[] = "/tmp/pdr_cache_test.XXXXXX";
+        dir = fs::path(mkdtemp(tmpdir));
+        info.updateTime[0] = 0x12;
+        info.oemUpdateTime[12] = 0x34;
+        info.recordCount = 2;
+        info.repositorySize = 26;
+        info.largestRecordSize = 15;
+
+        std::vector<uint8_t> first(sizeof(pldm_pdr_hdr) + 1, 0x11);
+        std::vector<uint8_t> second(sizeof(pldm_pdr_hdr) + 5, 0x22);
+        records.emplace_back(1, first);
+        records.emplace_back(7, second);
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(dir);
+    }
+
+    fs::path dir;
+    PDRRepositoryInfo info{};
+    PDRCache::Records records;
+};
+
+TEST_F(PDRCacheTest, missingCache)
+{
+    PDRCache cache(dir / "terminus_1");
+    EXPECT_FALSE(cache.load(info).has_value());
+}
+
+TEST_F(PDRCacheTest, storeAndLoad)
+{
+    PDRCache cache(dir / "cache" / "terminus_1");
+    ASSERT_TRUE(cache.store(info, records));
+    EXPECT_FALSE(fs::exists(dir / "cache" / "terminus_1.tmp"));
+
+    auto loaded = cache.load(info);
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(*loaded, records);
+}
+
+TEST_F(PDRCacheTest, changedRepositoryMisses)
+{
+    PDRCache cache(dir / "terminus_1");
+    ASSERT_TRUE(cache.store(info, records));
+
+    auto changed = info;
+    changed.updateTime[3] = 0x01;
+    EXPECT_FALSE(cache.load(changed).has_value());
+
+    changed = info;
+    changed.recordCount++;
+    EXPECT_FALSE(cache.load(changed).has_value());
+
+    changed = info;
+    changed.repositorySize++;
+    EXPECT_FALSE(cache.load(changed).has_value());
+
+    EXPECT_TRUE(cache.load(info).has_value());
+}
+
+TEST_F(PDRCacheTest, truncatedCacheMisses)
+{
+    auto path = dir / "terminus_1";
+    PDRCache cache(path);
+    ASSERT_TRUE(cache.store(info, records));
+
+    fs::resize_file(path, fs::file_size(path) - 1);
+    EXPECT_FALSE(cache.load(info).has_value());
+}
+
+TEST_F(PDRCacheTest, invalidate)
+{
+    auto path = dir / "terminus_1";
+    PDRCache cache(path);
+    ASSERT_TRUE(cache.store(info, records));
+
+    cache.invalidate();
+    EXPECT_FALSE(fs::exists(path));
+    EXPECT_FALSE(cache.load(info).has_value());
+    /* Dropping a missing cache is harmless */
+    cache.invalidate();
+}
+
+TEST(PDRRepositoryInfo, hasUpdateTime)
+{
+    PDRRepositoryInfo info{};
+    info.recordCount = 2;
+    EXPECT_FALSE(info.hasUpdateTime());
+
+    info.oemUpdateTime[12] = 0x34;
+    EXPECT_TRUE(info.hasUpdateTime());
+
+    info.oemUpdateTime = {};
+    info.updateTime[0] = 0x12;
+    EXPECT_TRUE(info.hasUpdateTime());
+}
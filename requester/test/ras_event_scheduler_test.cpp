@@ -0,0 +1,115 @@
+#include "requester/ras_event_scheduler.hpp"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm;
+using Priority = RasEventScheduler::Priority;
+
+TEST(RasEventScheduler, priorityOrder)
+{
+    RasEventScheduler scheduler(16);
+    EXPECT_FALSE(scheduler.front());
+
+    EXPECT_EQ(scheduler.push(10, Priority::Critical), 0);
+    EXPECT_EQ(scheduler.push(11, Priority::Critical), 0);
+    EXPECT_EQ(scheduler.push(20, Priority::Overflow), 0);
+    EXPECT_EQ(scheduler.push(200, Priority::Bert), 0);
+
+    std::vector<uint16_t> served;
+    while (auto next = scheduler.front())
+    {
+        served.push_back(next->id);
+        scheduler.pop(next->priority);
+    }
+    EXPECT_EQ(served, (std::vector<uint16_t>{200, 20, 10, 11}));
+    EXPECT_TRUE(scheduler.empty());
+}
+
+TEST(RasEventScheduler, duplicatesAndFull)
+{
+    RasEventScheduler scheduler(2);
+
+    EXPECT_EQ(scheduler.push(1, Priority::Critical), 0);
+    EXPECT_EQ(scheduler.push(1, Priority::Critical), -2);
+    /* The same ID may be queued with another priority */
+    EXPECT_EQ(scheduler.push(1, Priority::Overflow), 0);
+    EXPECT_EQ(scheduler.push(2, Priority::Critical), 0);
+    EXPECT_EQ(scheduler.push(3, Priority::Critical), -1);
+    EXPECT_EQ(scheduler.size(Priority::Critical), 2);
+
+    /* Neither a dropped nor a served ID is kept as queued */
+    scheduler.pop(Priority::Critical);
+    EXPECT_EQ(scheduler.push(3, Priority::Critical), 0);
+    EXPECT_EQ(scheduler.push(1, Priority::Critical), -1);
+    scheduler.pop(Priority::Critical);
+    EXPECT_EQ(scheduler.push(1, Priority::Critical), 0);
+
+    auto counters = scheduler.getCounters();
+    EXPECT_EQ(counters["Critical.Enqueued"], 4);
+    EXPECT_EQ(counters["Critical.Duplicates"], 1);
+    EXPECT_EQ(counters["Critical.Dropped"], 2);
+    EXPECT_EQ(counters["Critical.Served"], 2);
+    EXPECT_EQ(counters["Critical.Queued"], 2);
+    EXPECT_EQ(counters["Critical.MaxQueued"], 2);
+    EXPECT_EQ(counters["Overflow.Queued"], 1);
+
+    scheduler.clear();
+    EXPECT_TRUE(scheduler.empty());
+    EXPECT_EQ(scheduler.push(1, Priority::Critical), 0);
+}
+
+TEST(RasEventScheduler, latencyHistogram)
+{
+    RasEventScheduler scheduler(256);
+    RasEventScheduler::Clock::time_point start{};
+
+    for (uint16_t id = 0; id < 100; id++)
+    {
+        scheduler.push(id, Priority::Critical, start);
+    }
+    /* 99 events served after 100us, the last one after 5ms */
+    for (int i = 0; i < 99; i++)
+    {
+        scheduler.pop(Priority::Critical,
+                      start + std::chrono::microseconds(100));
+    }
+    scheduler.pop(Priority::Critical, start + std::chrono::milliseconds(5));
+
+    auto counters = scheduler.getCounters();
+    EXPECT_EQ(counters["Critical.LatencyUsBelow128"], 99);
+    EXPECT_EQ(counters["Critical.LatencyUsBelow8192"], 1);
+    EXPECT_EQ(counters["Critical.P50LatencyUs"], 127);
+    EXPECT_EQ(counters["Critical.P99LatencyUs"], 127);
+    EXPECT_EQ(counters["Bert.P99LatencyUs"], 0);
+}
+
+TEST(RasEventSchedulerThroughput, burst)
+{
+    constexpr int rounds = 2000;
+    RasEventScheduler scheduler(256);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++)
+    {
+        /* A burst of corrected errors, each signalled twice */
+        for (uint16_t id = 1; id <= 256; id++)
+        {
+            scheduler.push(id, Priority::Critical);
+            scheduler.push(id, Priority::Critical);
+        }
+        while (auto next = scheduler.front())
+        {
+            scheduler.pop(next->priority);
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    EXPECT_EQ(scheduler.getCounters()["Critical.Served"], rounds * 256);
+    auto nsPerEvent = elapsed.count() * 1000 / (rounds * 256);
+    RecordProperty("ns_per_event", std::to_string(nsPerEvent));
+}
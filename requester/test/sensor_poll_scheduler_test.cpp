@@ -0,0 +1,164 @@
+#include "requester/sensor_poll_scheduler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace pldm::terminus;
+using namespace std::chrono;
+
+TEST(SensorPollScheduler, pollPeriodTicks)
+{
+    EXPECT_EQ(pollPeriodTicks(PLDM_RATE_UNIT_NONE, seconds(1)), 1);
+    EXPECT_EQ(pollPeriodTicks(PLDM_RATE_UNIT_PER_MILLI_SECOND, seconds(1)), 1);
+    EXPECT_EQ(pollPeriodTicks(PLDM_RATE_UNIT_PER_SECOND, seconds(1)), 1);
+    EXPECT_EQ(pollPeriodTicks(PLDM_RATE_UNIT_PER_MINUTE, seconds(1)), 60);
+    EXPECT_EQ(pollPeriodTicks(PLDM_RATE_UNIT_PER_MINUTE, milliseconds(7000)),
+              9);
+    EXPECT_EQ(pollPeriodTicks(PLDM_RATE_UNIT_PER_HOUR, seconds(1)), 3600);
+    EXPECT_EQ(pollPeriodTicks(PLDM_RATE_UNIT_PER_YEAR, seconds(1)), 3600);
+    EXPECT_EQ(pollPeriodTicks(PLDM_RATE_UNIT_PER_MINUTE, milliseconds(0)), 1);
+}
+
+TEST(SensorPollScheduler, sensorsAreReadOnlyWhenDue)
+{
+    SensorPollScheduler<int> scheduler(10);
+    scheduler.add(1, 1);
+    scheduler.add(2, 2);
+    scheduler.add(3, 5);
+    EXPECT_EQ(scheduler.size(), 3);
+
+    std::vector<std::vector<int>> rounds;
+    for (int i = 0; i < 6; i++)
+    {
+        auto due = scheduler.advance();
+        std::sort(due.begin(), due.end());
+        rounds.emplace_back(due);
+    }
+
+    EXPECT_EQ(rounds[0], (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(rounds[1], (std::vector<int>{1}));
+    EXPECT_EQ(rounds[2], (std::vector<int>{1, 2}));
+    EXPECT_EQ(rounds[3], (std::vector<int>{1}));
+    EXPECT_EQ(rounds[4], (std::vector<int>{1, 2}));
+    EXPECT_EQ(rounds[5], (std::vector<int>{1, 3}));
+
+    EXPECT_EQ(scheduler.getDueReads(), 11);
+    EXPECT_EQ(scheduler.getSkippedReads(), 7);
+}
+
+TEST(SensorPollScheduler, removeAndReAdd)
+{
+    SensorPollScheduler<int> scheduler(4);
+    scheduler.add(1, 2);
+    scheduler.add(2, 2);
+    EXPECT_EQ(scheduler.advance().size(), 2);
+
+    scheduler.remove(2);
+    EXPECT_FALSE(scheduler.contains(2));
+    EXPECT_EQ(scheduler.keys(), (std::vector<int>{1}));
+    EXPECT_TRUE(scheduler.advance().empty());
+    EXPECT_EQ(scheduler.advance(), (std::vector<int>{1}));
+
+    // A re-added sensor is due right away and only once per period
+    scheduler.add(2, 2);
+    EXPECT_EQ(scheduler.advance(), (std::vector<int>{2}));
+    auto due = scheduler.advance();
+    EXPECT_EQ(due, (std::vector<int>{1}));
+    EXPECT_EQ(scheduler.advance(), (std::vector<int>{2}));
+}
+
+TEST(SensorPollScheduler, periodIsClampedToWheel)
+{
+    SensorPollScheduler<int> scheduler(3);
+    scheduler.add(1, 100);
+    EXPECT_EQ(scheduler.advance().size(), 1);
+    EXPECT_TRUE(scheduler.advance().empty());
+    EXPECT_TRUE(scheduler.advance().empty());
+    EXPECT_EQ(scheduler.advance().size(), 1);
+}
+
+TEST(SensorPollScheduler, postponedSensorIsReadForLiveness)
+{
+    SensorPollScheduler<int> scheduler(10);
+    scheduler.add(1, 1);
+    scheduler.add(2, 1);
+    EXPECT_EQ(scheduler.advance().size(), 2);
+
+    // Sensor 2 pushes its value, it is only read again after 5 rounds
+    scheduler.postpone(2, 5);
+    EXPECT_EQ(scheduler.getEventDriven(), 1);
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(scheduler.advance(), (std::vector<int>{1}));
+    }
+    // Pushed again before it is due, the liveness reading moves along
+    scheduler.postpone(2, 5);
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(scheduler.advance(), (std::vector<int>{1}));
+    }
+    EXPECT_EQ(scheduler.getEventDriven(), 1);
+
+    // No event since, the liveness reading puts it back on its period
+    auto due = scheduler.advance();
+    std::sort(due.begin(), due.end());
+    EXPECT_EQ(due, (std::vector<int>{1, 2}));
+    EXPECT_EQ(scheduler.getEventDriven(), 0);
+    EXPECT_EQ(scheduler.advance().size(), 2);
+    EXPECT_EQ(scheduler.advance().size(), 2);
+    EXPECT_EQ(scheduler.getSkippedReads(), 8);
+
+    scheduler.postpone(3, 1);
+    EXPECT_FALSE(scheduler.contains(3));
+    EXPECT_EQ(scheduler.getEventDriven(), 0);
+}
+
+TEST(SensorPollScheduler, postponeKeepsThePollingPeriod)
+{
+    SensorPollScheduler<int> scheduler(10);
+    scheduler.add(1, 4);
+    EXPECT_EQ(scheduler.advance().size(), 1);
+
+    // A delay shorter than the period takes effect right away
+    scheduler.postpone(1, 1);
+    EXPECT_EQ(scheduler.advance().size(), 1);
+    EXPECT_EQ(scheduler.getEventDriven(), 0);
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_TRUE(scheduler.advance().empty());
+    }
+    EXPECT_EQ(scheduler.advance().size(), 1);
+
+    // Removing an event driven sensor drops it from the count
+    scheduler.postpone(1, 8);
+    EXPECT_EQ(scheduler.getEventDriven(), 1);
+    scheduler.remove(1);
+    EXPECT_EQ(scheduler.getEventDriven(), 0);
+    EXPECT_EQ(scheduler.size(), 0);
+}
+
+TEST(SensorPollScheduler, livenessPeriodTicks)
+{
+    using namespace std::chrono_literals;
+    EXPECT_EQ(livenessPeriodTicks(0s, 1000ms), 0);
+    EXPECT_EQ(livenessPeriodTicks(10s, 1000ms), 10);
+    EXPECT_EQ(livenessPeriodTicks(10s, 3000ms), 4);
+    EXPECT_EQ(livenessPeriodTicks(1s, 5000ms), 1);
+    EXPECT_EQ(livenessPeriodTicks(1s, 0ms), 1);
+}
+
+TEST(SensorPollScheduler, decodeEventReading)
+{
+    EXPECT_EQ(decodeEventReading(PLDM_SENSOR_DATA_SIZE_UINT8, 0xff), 255);
+    EXPECT_EQ(decodeEventReading(PLDM_SENSOR_DATA_SIZE_SINT8, 0xff), -1);
+    EXPECT_EQ(decodeEventReading(PLDM_SENSOR_DATA_SIZE_UINT16, 0xfffe),
+              65534);
+    EXPECT_EQ(decodeEventReading(PLDM_SENSOR_DATA_SIZE_SINT16, 0xfffe), -2);
+    EXPECT_EQ(decodeEventReading(PLDM_SENSOR_DATA_SIZE_UINT32, 0xffffffff),
+              4294967295.0);
+    EXPECT_EQ(decodeEventReading(PLDM_SENSOR_DATA_SIZE_SINT32, 0xfffffffd),
+              -3);
+    EXPECT_EQ(decodeEventReading(6, 1), std::nullopt);
+}
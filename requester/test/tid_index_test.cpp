@@ -0,0 +1,132 @@
+#include "requester/tid_index.hpp"
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+using namespace pldm::terminus;
+
+/** @struct Terminus
+ *
+ *  Terminus handler stand-in, reports its TID changes like
+ *  TerminusHandler::setTid()
+ */
+struct Terminus
+{
+    uint8_t tid = PLDM_TID_RESERVED;
+    std::function<void(uint8_t, uint8_t)> tidChangeHandler;
+
+    void setTid(uint8_t newTid)
+    {
+        auto oldTid = tid;
+        tid = newTid;
+        if (oldTid != newTid && tidChangeHandler)
+        {
+            tidChangeHandler(oldTid, newTid);
+        }
+    }
+};
+
+/** @brief Termini of each EID indexed the way terminus::Manager does */
+class TidIndexTest : public testing::Test
+{
+  protected:
+    Terminus* addDevice(uint8_t eid)
+    {
+        auto dev = std::make_unique<Terminus>();
+        dev->tidChangeHandler = [this, ptr = dev.get()](uint8_t oldTid,
+                                                        uint8_t newTid) {
+            tidIndex.move(ptr, oldTid, newTid);
+        };
+        if (devices.contains(eid))
+        {
+            tidIndex.remove(devices[eid]->tid, devices[eid].get());
+        }
+        auto ptr = dev.get();
+        devices[eid] = std::move(dev);
+        return ptr;
+    }
+
+    void removeDevice(uint8_t eid)
+    {
+        tidIndex.remove(devices[eid]->tid, devices[eid].get());
+        devices.erase(eid);
+    }
+
+    std::map<uint8_t, std::unique_ptr<Terminus>> devices;
+    TidIndex<Terminus> tidIndex;
+};
+
+TEST_F(TidIndexTest, unknownTidIsNotIndexed)
+{
+    auto dev = addDevice(10);
+    EXPECT_EQ(tidIndex.size(), 0);
+    EXPECT_TRUE(tidIndex.find(PLDM_TID_RESERVED).empty());
+
+    dev->setTid(1);
+    EXPECT_EQ(tidIndex.find(1), std::vector<Terminus*>{dev});
+
+    removeDevice(10);
+    EXPECT_TRUE(tidIndex.find(1).empty());
+    EXPECT_EQ(tidIndex.size(), 0);
+}
+
+TEST_F(TidIndexTest, handlerReplacedOnSameEid)
+{
+    auto oldDev = addDevice(10);
+    oldDev->setTid(1);
+
+    // The EID is added again, the new handler has no TID until discovered
+    auto newDev = addDevice(10);
+    EXPECT_TRUE(tidIndex.find(1).empty());
+
+    newDev->setTid(1);
+    EXPECT_EQ(tidIndex.find(1), std::vector<Terminus*>{newDev});
+
+    removeDevice(10);
+    EXPECT_EQ(tidIndex.size(), 0);
+}
+
+TEST_F(TidIndexTest, tidChangedOnRediscovery)
+{
+    auto dev = addDevice(10);
+    dev->setTid(1);
+
+    dev->setTid(2);
+    EXPECT_TRUE(tidIndex.find(1).empty());
+    EXPECT_EQ(tidIndex.find(2), std::vector<Terminus*>{dev});
+    EXPECT_EQ(tidIndex.size(), 1);
+
+    // GetTID failed, the terminus is left out until it reports a TID again
+    dev->setTid(PLDM_TID_RESERVED);
+    EXPECT_TRUE(tidIndex.find(2).empty());
+    EXPECT_EQ(tidIndex.size(), 0);
+
+    dev->setTid(2);
+    EXPECT_EQ(tidIndex.find(2), std::vector<Terminus*>{dev});
+}
+
+TEST_F(TidIndexTest, twoEidsWithSameTid)
+{
+    auto dev1 = addDevice(10);
+    auto dev2 = addDevice(11);
+    dev1->setTid(1);
+    dev2->setTid(1);
+    EXPECT_EQ(tidIndex.find(1), (std::vector<Terminus*>{dev1, dev2}));
+
+    // Indexing a terminus twice does not duplicate it
+    tidIndex.add(1, dev1);
+    EXPECT_EQ(tidIndex.find(1), (std::vector<Terminus*>{dev1, dev2}));
+
+    // One of them moving away leaves the other one indexed
+    dev1->setTid(3);
+    EXPECT_EQ(tidIndex.find(1), std::vector<Terminus*>{dev2});
+    EXPECT_EQ(tidIndex.find(3), std::vector<Terminus*>{dev1});
+
+    removeDevice(11);
+    EXPECT_TRUE(tidIndex.find(1).empty());
+    EXPECT_EQ(tidIndex.find(3), std::vector<Terminus*>{dev1});
+}
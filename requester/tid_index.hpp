@@ -0,0 +1,113 @@
+#pragma once
+
+#include <libpldm/base.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <vector>
+
+namespace pldm
+{
+
+namespace terminus
+{
+
+/** @class TidIndex
+ *
+ *  Index of the managed termini on the TID they reported in GetTID, used to
+ *  route the events which only carry a TID. The TID is not required to be
+ *  unique across the EIDs, more than one terminus can then have the TID.
+ *  A terminus without a known TID is not indexed.
+ *
+ *  @tparam Terminus - terminus handler type
+ */
+template <typename Terminus>
+class TidIndex
+{
+  public:
+    /** @brief Add a terminus to the index
+     *
+     *  @param[in] tid - TID of the terminus
+     *  @param[in] dev - terminus handler
+     */
+    void add(uint8_t tid, Terminus* dev)
+    {
+        if (tid == PLDM_TID_RESERVED)
+        {
+            return;
+        }
+        auto& devices = tidDevices[tid];
+        if (std::find(devices.begin(), devices.end(), dev) == devices.end())
+        {
+            devices.emplace_back(dev);
+        }
+        if (devices.size() > 1)
+        {
+            std::cerr << "TID " << unsigned(tid) << " is used by "
+                      << devices.size() << " termini" << std::endl;
+        }
+    }
+
+    /** @brief Remove a terminus from the index
+     *
+     *  @param[in] tid - TID of the terminus
+     *  @param[in] dev - terminus handler
+     */
+    void remove(uint8_t tid, Terminus* dev)
+    {
+        auto it = tidDevices.find(tid);
+        if (it == tidDevices.end())
+        {
+            return;
+        }
+        std::erase(it->second, dev);
+        if (it->second.empty())
+        {
+            tidDevices.erase(it);
+        }
+    }
+
+    /** @brief Move a terminus which reported a new TID
+     *
+     *  @param[in] dev - terminus handler
+     *  @param[in] oldTid - previous TID of the terminus
+     *  @param[in] newTid - new TID of the terminus
+     */
+    void move(Terminus* dev, uint8_t oldTid, uint8_t newTid)
+    {
+        remove(oldTid, dev);
+        add(newTid, dev);
+    }
+
+    /** @brief Get the termini with a TID
+     *
+     *  @param[in] tid - Terminus ID
+     *
+     *  @return the termini, empty when the TID is unknown
+     */
+    std::vector<Terminus*> find(uint8_t tid) const
+    {
+        auto it = tidDevices.find(tid);
+        if (it == tidDevices.end())
+        {
+            return {};
+        }
+        return it->second;
+    }
+
+    /** @brief Get the number of indexed TIDs */
+    size_t size() const
+    {
+        return tidDevices.size();
+    }
+
+  private:
+    /** @brief Termini of each TID */
+    std::map<uint8_t, std::vector<Terminus*>> tidDevices;
+};
+
+} // namespace terminus
+
+} // namespace pldm